@@ -0,0 +1,22 @@
+#-------------------------------------------------
+QT       += core gui testlib
+
+greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
+
+CONFIG += c++11 console
+CONFIG -= app_bundle
+
+TARGET = benchmarks
+
+# NOTE : only models are benchmarked, QUaServer is not needed
+include($$PWD/../src/quamodelview.pri)
+
+SOURCES += \
+main.cpp \
+quamodelbench.cpp
+
+HEADERS += \
+benchnode.h \
+quamodelbench.h
+
+include($$PWD/../libs/add_qt_path_win.pri)
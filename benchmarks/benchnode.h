@@ -0,0 +1,154 @@
+#ifndef BENCHNODE_H
+#define BENCHNODE_H
+
+#include <QObject>
+#include <QQueue>
+#include <QUaModelItemTraits>
+
+// synthetic node type, mimics QUaNode's interface used by the models
+// (children, child added and destroyed signals, value changes)
+class BenchNode : public QObject
+{
+    Q_OBJECT
+public:
+    explicit BenchNode(BenchNode* parent = nullptr)
+        : QObject(parent), m_value(0)
+    {
+    }
+
+    // create child and notify, like QUaNode does when adding instances
+    inline BenchNode* addChild()
+    {
+        auto child = new BenchNode(this);
+        emit this->childAdded(child);
+        return child;
+    }
+
+    // reparent and notify, no childAdded nor destroyed, row is where
+    // models place it (-1 is last), QObject children keep it last
+    inline void moveTo(BenchNode* parent, const int& row = -1)
+    {
+        this->setParent(parent);
+        emit this->moved(parent, row);
+    }
+
+    inline QList<BenchNode*> browseChildren() const
+    {
+        QList<BenchNode*> children;
+        for (auto child : this->children())
+        {
+            children << static_cast<BenchNode*>(child);
+        }
+        return children;
+    }
+
+    inline int value() const
+    {
+        return m_value;
+    }
+
+    inline void setValue(const int& value)
+    {
+        m_value = value;
+        emit this->valueChanged(value);
+    }
+
+    // notify change of a single column (used by trace replay)
+    inline void touch(const int& column)
+    {
+        emit this->columnChanged(column);
+    }
+
+    // build tree of count nodes under a new root (root not counted),
+    // breadth first, each node has up to fanout children
+    // NOTE : no childAdded emitted, build before binding to a model
+    inline static BenchNode* buildTree(const int& count, const int& fanout = 10)
+    {
+        auto root = new BenchNode();
+        QQueue<BenchNode*> parents;
+        parents.enqueue(root);
+        int created = 0;
+        while (created < count)
+        {
+            auto parent = parents.dequeue();
+            for (int i = 0; i < fanout && created < count; i++)
+            {
+                parents.enqueue(new BenchNode(parent));
+                created++;
+            }
+        }
+        return root;
+    }
+
+signals:
+    void childAdded(BenchNode* child);
+    void moved(BenchNode* parent, int row);
+    void valueChanged(int value);
+    void columnChanged(int column);
+
+private:
+    int m_value;
+};
+
+// specialized implementation for BenchNode*
+
+template<>
+inline QMetaObject::Connection 
+QUaModelItemTraits::DestroyCallback<BenchNode*, 0>(
+    BenchNode* node, 
+    const std::function<void(void)> &callback)
+{
+    if (!node)
+    {
+        return QMetaObject::Connection();
+    }
+    return QObject::connect(node, &QObject::destroyed,
+    [callback]() {
+        callback();
+    });
+}
+
+template<>
+inline QMetaObject::Connection
+QUaModelItemTraits::NewChildCallback<BenchNode*, 0>(
+    BenchNode* node, 
+    const std::function<void(BenchNode*)> &callback)
+{
+    if (!node)
+    {
+        return QMetaObject::Connection();
+    }
+    return QObject::connect(node, &BenchNode::childAdded,
+    [callback](BenchNode* child) {
+        callback(child);
+    });
+}
+
+template<>
+inline QMetaObject::Connection
+QUaModelItemTraits::MoveCallback<BenchNode*, 0>(
+    BenchNode* node, 
+    const std::function<void(BenchNode*, int)> &callback)
+{
+    if (!node)
+    {
+        return QMetaObject::Connection();
+    }
+    return QObject::connect(node, &BenchNode::moved,
+    [callback](BenchNode* parent, int row) {
+        callback(parent, row);
+    });
+}
+
+template<>
+inline QList<BenchNode*> 
+QUaModelItemTraits::GetChildren<BenchNode*, 0>(BenchNode* node)
+{
+    if (!node)
+    {
+        return QList<BenchNode*>();
+    }
+    return node->browseChildren();
+}
+
+#endif // BENCHNODE_H
@@ -0,0 +1,16 @@
+#include "quamodelbench.h"
+
+#include <QApplication>
+#include <QtTest>
+
+// NOTE : run headless, no display needed (e.g. CI)
+int main(int argc, char *argv[])
+{
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+    {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QApplication a(argc, argv);
+    QUaModelBench bench;
+    return QTest::qExec(&bench, argc, argv);
+}
@@ -0,0 +1,327 @@
+#include "quamodelbench.h"
+
+#include <QtTest>
+
+#include <QUaTreeModel>
+#include <QUaTableModel>
+
+#include <random>
+#include <algorithm>
+
+#include "benchnode.h"
+
+namespace
+{
+// same columns for all benchmarks, second one changes with node's value
+template<typename M>
+void setupColumns(M& model)
+{
+    model.setColumnDataSource(0, QObject::tr("Name"),
+    [](BenchNode* node, const Qt::ItemDataRole& role) -> QVariant {
+        if (role == Qt::DisplayRole)
+        {
+            return node->objectName();
+        }
+        return QVariant();
+    });
+    model.setColumnDataSource(1, QObject::tr("Value"),
+    [](BenchNode* node, const Qt::ItemDataRole& role) -> QVariant {
+        if (role == Qt::DisplayRole)
+        {
+            return node->value();
+        }
+        return QVariant();
+    },
+    [](BenchNode* node, std::function<void()> changeCallback) {
+        return QList<QMetaObject::Connection>() <<
+            QObject::connect(node, &BenchNode::valueChanged,
+            [changeCallback]() {
+                changeCallback();
+            });
+    });
+}
+
+// parentless nodes, as shown by table models
+QList<BenchNode*> createNodes(const int& count)
+{
+    QList<BenchNode*> nodes;
+    nodes.reserve(count);
+    for (int i = 0; i < count; i++)
+    {
+        nodes << new BenchNode();
+    }
+    return nodes;
+}
+
+// same order on every run
+QList<BenchNode*> shuffled(QList<BenchNode*> nodes)
+{
+    std::mt19937 generator(1);
+    std::shuffle(nodes.begin(), nodes.end(), generator);
+    return nodes;
+}
+
+// visit all rows calling index, parent and data like a view does
+int traverse(const QAbstractItemModel& model, const QModelIndex& parent)
+{
+    int visited = 0;
+    int rows = model.rowCount(parent);
+    int cols = model.columnCount(parent);
+    for (int row = 0; row < rows; row++)
+    {
+        QModelIndex index = model.index(row, 0, parent);
+        Q_ASSERT(model.parent(index) == parent);
+        model.parent(index);
+        for (int col = 0; col < cols; col++)
+        {
+            model.data(model.index(row, col, parent), Qt::DisplayRole);
+        }
+        visited += 1 + traverse(model, index);
+    }
+    return visited;
+}
+}
+
+void QUaModelBench::addCounts(const QList<int>& counts)
+{
+    QTest::addColumn<int>("count");
+    for (auto count : counts)
+    {
+        QString strName = count >= 1000000 ? 
+            QString("%1M").arg(count / 1000000) : 
+            QString("%1k").arg(count / 1000);
+        QTest::newRow(strName.toUtf8().constData()) << count;
+    }
+}
+
+void QUaModelBench::setRootNode_data()
+{
+    this->addCounts(QList<int>() << 10000 << 100000 << 1000000);
+}
+
+void QUaModelBench::setRootNode()
+{
+    QFETCH(int, count);
+    auto root = BenchNode::buildTree(count);
+    QUaTreeModel<BenchNode*> model;
+    setupColumns(model);
+    // NOTE : includes unbinding, else only first iteration would bind
+    QBENCHMARK {
+        model.setRootNode(root);
+        model.setRootNode(nullptr);
+    }
+    delete root;
+}
+
+void QUaModelBench::destroySubtree_data()
+{
+    this->addCounts(QList<int>() << 10000 << 100000);
+}
+
+void QUaModelBench::destroySubtree()
+{
+    QFETCH(int, count);
+    // whole tree hangs from a single branch, deleting it cascades
+    auto root   = new BenchNode();
+    auto branch = BenchNode::buildTree(count);
+    branch->setParent(root);
+    QUaTreeModel<BenchNode*> model;
+    setupColumns(model);
+    model.setRootNode(root);
+    QCOMPARE(model.rowCount(), 1);
+    QBENCHMARK_ONCE {
+        delete branch;
+    }
+    QCOMPARE(model.rowCount(), 0);
+    model.setRootNode(nullptr);
+    delete root;
+}
+
+void QUaModelBench::moveSubtree_data()
+{
+    this->addCounts(QList<int>() << 10000 << 100000);
+}
+
+void QUaModelBench::moveSubtree()
+{
+    QFETCH(int, count);
+    // whole tree hangs from a single branch, moved to an empty sibling
+    auto root   = new BenchNode();
+    auto branch = BenchNode::buildTree(count);
+    branch->setParent(root);
+    auto target = new BenchNode(root);
+    QUaTreeModel<BenchNode*> model;
+    setupColumns(model);
+    model.setRootNode(root);
+    QCOMPARE(model.rowCount(), 2);
+    // NOTE : relinks wrappers, no sub-tree rebuild
+    QBENCHMARK_ONCE {
+        branch->moveTo(target);
+    }
+    QCOMPARE(model.rowCount(), 1);
+    QCOMPARE(model.rowCount(model.index(0, 0)), 1);
+    model.setRootNode(nullptr);
+    delete root;
+}
+
+void QUaModelBench::valueChurn_data()
+{
+    this->addCounts(QList<int>() << 10000 << 100000);
+}
+
+void QUaModelBench::valueChurn()
+{
+    QFETCH(int, count);
+    auto root  = BenchNode::buildTree(count);
+    auto nodes = root->findChildren<BenchNode*>();
+    QUaTreeModel<BenchNode*> model;
+    setupColumns(model);
+    model.setRootNode(root);
+    int value = 0;
+    // NOTE : processEvents flushes coalesced dataChanged notifications
+    QBENCHMARK {
+        for (auto node : nodes)
+        {
+            node->setValue(++value);
+        }
+        QCoreApplication::processEvents();
+    }
+    model.setRootNode(nullptr);
+    delete root;
+}
+
+void QUaModelBench::traversal_data()
+{
+    this->addCounts(QList<int>() << 10000 << 100000);
+}
+
+void QUaModelBench::traversal()
+{
+    QFETCH(int, count);
+    auto root = BenchNode::buildTree(count);
+    QUaTreeModel<BenchNode*> model;
+    setupColumns(model);
+    model.setRootNode(root);
+    int visited = 0;
+    QBENCHMARK {
+        visited = traverse(model, QModelIndex());
+    }
+    QCOMPARE(visited, count);
+    model.setRootNode(nullptr);
+    delete root;
+}
+
+void QUaModelBench::wrapperMemory_data()
+{
+    this->addCounts(QList<int>() << 100000 << 500000);
+}
+
+void QUaModelBench::wrapperMemory()
+{
+    QFETCH(int, count);
+    auto root = BenchNode::buildTree(count);
+    QUaTreeModel<BenchNode*> model;
+    setupColumns(model);
+    // NOTE : measured, not a timing, pool is empty before binding
+    auto before = model.memoryReport();
+    model.setRootNode(root);
+    auto after = model.memoryReport();
+    QCOMPARE(after.wrappers, count + 1);
+    quint64 poolBytes = after.poolReservedBytes - before.poolReservedBytes;
+    qDebug().noquote() << QString(
+        "sizeof(QUaNodeWrapper) : %1 bytes, pool block : %2 bytes\n"
+        "pool blocks used : %3 -> %4, reserved : %5 -> %6 bytes\n"
+        "pool bytes per wrapper : %7, total model bytes per wrapper : %8")
+        .arg(after.wrapperSize)
+        .arg(after.wrapperBlockSize)
+        .arg(before.poolUsedBlocks)
+        .arg(after.poolUsedBlocks)
+        .arg(before.poolReservedBytes)
+        .arg(after.poolReservedBytes)
+        .arg(static_cast<double>(poolBytes) / after.wrappers, 0, 'f', 1)
+        .arg(static_cast<double>(after.totalBytes()) / after.wrappers, 0, 'f', 1);
+    model.setRootNode(nullptr);
+    delete root;
+}
+
+void QUaModelBench::addNode_data()
+{
+    this->addCounts(QList<int>() << 10000 << 100000);
+}
+
+void QUaModelBench::addNode()
+{
+    QFETCH(int, count);
+    auto nodes = createNodes(count);
+    QBENCHMARK {
+        QUaTableModel<BenchNode*> model;
+        setupColumns(model);
+        for (auto node : nodes)
+        {
+            model.addNode(node);
+        }
+        QCOMPARE(model.count(), count);
+    }
+    qDeleteAll(nodes);
+}
+
+void QUaModelBench::addNodes_data()
+{
+    this->addCounts(QList<int>() << 10000 << 100000);
+}
+
+void QUaModelBench::addNodes()
+{
+    QFETCH(int, count);
+    auto nodes = createNodes(count);
+    QBENCHMARK {
+        QUaTableModel<BenchNode*> model;
+        setupColumns(model);
+        model.addNodes(nodes);
+        QCOMPARE(model.count(), count);
+    }
+    qDeleteAll(nodes);
+}
+
+void QUaModelBench::removeRandom_data()
+{
+    this->addCounts(QList<int>() << 10000 << 100000);
+}
+
+void QUaModelBench::removeRandom()
+{
+    QFETCH(int, count);
+    auto nodes = createNodes(count);
+    auto order = shuffled(nodes);
+    QUaTableModel<BenchNode*> model;
+    setupColumns(model);
+    model.addNodes(nodes);
+    QBENCHMARK_ONCE {
+        for (auto node : order)
+        {
+            model.removeNode(node);
+        }
+    }
+    QCOMPARE(model.count(), 0);
+    qDeleteAll(nodes);
+}
+
+void QUaModelBench::removeRandomBulk_data()
+{
+    this->addCounts(QList<int>() << 10000 << 100000);
+}
+
+void QUaModelBench::removeRandomBulk()
+{
+    QFETCH(int, count);
+    auto nodes = createNodes(count);
+    auto order = shuffled(nodes);
+    QUaTableModel<BenchNode*> model;
+    setupColumns(model);
+    model.addNodes(nodes);
+    QBENCHMARK_ONCE {
+        model.removeNodes(order);
+    }
+    QCOMPARE(model.count(), 0);
+    qDeleteAll(nodes);
+}
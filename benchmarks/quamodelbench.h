@@ -0,0 +1,40 @@
+#ifndef QUAMODELBENCH_H
+#define QUAMODELBENCH_H
+
+#include <QObject>
+
+// NOTE : build in release, run with -median N for stable numbers, e.g.
+//        ./benchmarks -median 5 setRootNode
+class QUaModelBench : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    // tree model
+    void setRootNode_data();
+    void setRootNode();
+    void destroySubtree_data();
+    void destroySubtree();
+    void moveSubtree_data();
+    void moveSubtree();
+    void valueChurn_data();
+    void valueChurn();
+    void traversal_data();
+    void traversal();
+    void wrapperMemory_data();
+    void wrapperMemory();
+    // table model
+    void addNode_data();
+    void addNode();
+    void addNodes_data();
+    void addNodes();
+    void removeRandom_data();
+    void removeRandom();
+    void removeRandomBulk_data();
+    void removeRandomBulk();
+
+private:
+    void addCounts(const QList<int>& counts);
+};
+
+#endif // QUAMODELBENCH_H
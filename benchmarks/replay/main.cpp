@@ -0,0 +1,145 @@
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QTextStream>
+
+#include <QUaTreeModel>
+#include <QUaTreeView>
+#include <QUaModelTrace>
+
+#include "benchnode.h"
+
+// replays a trace recorded with QUaModelTraceRecorder into a tree model of
+// synthetic nodes, optionally shown in a tree view, and reports frame times
+// usage : replay [--realtime] [--view] [--batch N] trace.quat
+int main(int argc, char *argv[])
+{
+    // NOTE : run headless, no display needed (e.g. CI)
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+    {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QApplication a(argc, argv);
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    parser.addOption({ "realtime", "Replay at recorded speed." });
+    parser.addOption({ "view"    , "Attach model to a tree view." });
+    parser.addOption({ "batch"   , "Max records per frame if not real time.", "N", "256" });
+    parser.addPositionalArgument("trace", "Trace file.");
+    parser.process(a);
+    QTextStream out(stdout);
+    if (parser.positionalArguments().isEmpty())
+    {
+        parser.showHelp(1);
+    }
+    QUaModelTraceReader reader;
+    QString strFile = parser.positionalArguments().first();
+    if (!reader.open(strFile))
+    {
+        out << "Invalid trace file " << strFile << "\n";
+        out.flush();
+        return 1;
+    }
+    // nodes by recorded id, 0 is root
+    auto root = new BenchNode();
+    QHash<quint32, BenchNode*> hashNodes;
+    QHash<BenchNode*, quint32> hashIds;
+    hashNodes[0] = root;
+    // one column per recorded column, each notifies its own changes
+    QUaTreeModel<BenchNode*> model;
+    for (int column = 0; column < qMax(1, reader.columnCount()); column++)
+    {
+        model.setColumnDataSource(column, QString::number(column),
+        [](BenchNode* node, const Qt::ItemDataRole& role) -> QVariant {
+            if (role == Qt::DisplayRole)
+            {
+                return node->value();
+            }
+            return QVariant();
+        },
+        [column](BenchNode* node, std::function<void()> changeCallback) {
+            return QList<QMetaObject::Connection>() <<
+                QObject::connect(node, &BenchNode::columnChanged,
+                [column, changeCallback](int changed) {
+                    if (changed == column)
+                    {
+                        changeCallback();
+                    }
+                });
+        });
+    }
+    model.setRootNode(root);
+    QUaTreeView<BenchNode*> view;
+    if (parser.isSet("view"))
+    {
+        view.setModel(&model);
+        view.resize(800, 600);
+        view.show();
+        view.expandAll();
+    }
+    // forget ids of node's sub-tree before deleting it
+    std::function<void(BenchNode*)> forget = [&](BenchNode* node) {
+        hashNodes.remove(hashIds.take(node));
+        for (auto child : node->browseChildren())
+        {
+            forget(child);
+        }
+    };
+    QUaModelTraceReplayer replayer;
+    replayer.setRealTime(parser.isSet("realtime"));
+    replayer.setMaxRecordsPerFrame(parser.value("batch").toInt());
+    replayer.setAddedCallback(
+    [&](quint32 id, quint32 parentId) {
+        auto parent = hashNodes.value(parentId, root);
+        auto node   = parent->addChild();
+        hashNodes[id]   = node;
+        hashIds[node]   = id;
+    });
+    replayer.setRemovedCallback(
+    [&](quint32 id) {
+        auto node = hashNodes.value(id, nullptr);
+        if (!node)
+        {
+            return;
+        }
+        forget(node);
+        delete node;
+    });
+    replayer.setChangedCallback(
+    [&](quint32 id, int column) {
+        auto node = hashNodes.value(id, nullptr);
+        if (!node)
+        {
+            return;
+        }
+        node->touch(column);
+    });
+    replayer.setMovedCallback(
+    [&](quint32 id, quint32 parentId, int row) {
+        auto node = hashNodes.value(id, nullptr);
+        if (!node)
+        {
+            return;
+        }
+        node->moveTo(hashNodes.value(parentId, root), row);
+    });
+    replayer.setResetCallback(
+    [&]() {
+        for (auto child : root->browseChildren())
+        {
+            forget(child);
+            delete child;
+        }
+    });
+    auto report = replayer.replay(reader);
+    out << "records      : " << report.records << "\n";
+    out << "frames       : " << report.frames << "\n";
+    out << "total (ms)   : " << report.totalMs << "\n";
+    out << "records/s    : " << report.recordsPerSecond << "\n";
+    out << "frame avg(ms): " << report.avgFrameMs << "\n";
+    out << "frame p99(ms): " << report.p99FrameMs << "\n";
+    out << "frame max(ms): " << report.maxFrameMs << "\n";
+    out.flush();
+    model.setRootNode(nullptr);
+    delete root;
+    return 0;
+}
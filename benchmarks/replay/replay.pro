@@ -0,0 +1,22 @@
+#-------------------------------------------------
+QT       += core gui
+
+greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
+
+CONFIG += c++11 console
+CONFIG -= app_bundle
+
+TARGET = replay
+
+# NOTE : only models are needed, QUaServer is not needed
+include($$PWD/../../src/quamodelview.pri)
+
+INCLUDEPATH += $$PWD/..
+
+SOURCES += \
+main.cpp
+
+HEADERS += \
+../benchnode.h
+
+include($$PWD/../../libs/add_qt_path_win.pri)
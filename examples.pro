@@ -7,7 +7,9 @@ amalgamation \
 02_nodetree \
 03_typetable \
 04_logwidget \
-05_historwidget
+05_historwidget \
+benchmarks \
+replay
 
 # directories
 amalgamation.subdir    = $$PWD/libs/QUaServer.git/src/amalgamation
@@ -16,6 +18,8 @@ amalgamation.subdir    = $$PWD/libs/QUaServer.git/src/amalgamation
 03_typetable.subdir    = $$PWD/examples/03_typetable
 04_logwidget.subdir    = $$PWD/examples/04_logwidget
 05_historwidget.subdir = $$PWD/examples/05_historwidget
+benchmarks.subdir      = $$PWD/benchmarks
+replay.subdir          = $$PWD/benchmarks/replay
 
 # dependencies
 01_server.depends       = amalgamation
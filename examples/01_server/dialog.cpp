@@ -145,10 +145,8 @@ void Dialog::setupLogTable()
     ui->tableViewLogs->setSelectionMode(QAbstractItemView::ExtendedSelection);
     ui->tableViewLogs->setDeleteCallback(
     [this](QList<QUaLog*> &logs) {
-        while (logs.count() > 0)
-        {
-            m_modelLog.removeNode(logs.takeFirst());
-        }
+        m_modelLog.removeNodes(logs);
+        logs.clear();
     });
     ui->tableViewLogs->setCopyCallback(
     [](const QList<QUaLog*> &logs) {
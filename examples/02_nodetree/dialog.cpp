@@ -216,17 +216,7 @@ void Dialog::setupTreeNodes()
 		}
 		return QVariant();
     },
-    [](QUaNode * node, std::function<void(void)> changeCallback) {
-        QList<QMetaObject::Connection> retList;
-        auto var = qobject_cast<QUaBaseVariable*>(node);
-        if (!var) { return retList; }
-        retList <<
-        QObject::connect(var, &QUaBaseVariable::valueChanged,
-        [changeCallback]() {
-            changeCallback();
-        });
-        return retList;
-    },
+    nullptr/* change signal added below, shared connection per node */,
     [](QUaNode * node) {
         auto var = qobject_cast<QUaBaseVariable*>(node);
         if (!var) { return false; }
@@ -242,17 +232,7 @@ void Dialog::setupTreeNodes()
 		}
 		return QVariant();
     },
-    [](QUaNode * node, std::function<void(void)> changeCallback) {
-        QList<QMetaObject::Connection> retList;
-        auto var = qobject_cast<QUaBaseVariable*>(node);
-        if (!var) { return retList; }
-        retList <<
-        QObject::connect(var, &QUaBaseVariable::sourceTimestampChanged,
-        [changeCallback]() {
-            changeCallback();
-        });
-        return retList;
-    },
+    nullptr/* change signal added below, shared connection per node */,
     [](QUaNode * node) {
         auto var = qobject_cast<QUaBaseVariable*>(node);
         if (!var) { return false; }
@@ -268,22 +248,24 @@ void Dialog::setupTreeNodes()
 		}
         return QVariant();
     },
-    [](QUaNode * node, std::function<void(void)> changeCallback) {
-        QList<QMetaObject::Connection> retList;
-        auto var = qobject_cast<QUaBaseVariable*>(node);
-        if (!var) { return retList; }
-        retList <<
-        QObject::connect(var, &QUaBaseVariable::serverTimestampChanged,
-        [changeCallback]() {
-            changeCallback();
-        });
-        return retList;
-    },
+    nullptr/* change signal added below, shared connection per node */,
     [](QUaNode * node) {
         auto var = qobject_cast<QUaBaseVariable*>(node);
         if (!var) { return false; }
         return true;
     });
+    // all nodes can be renamed
+    m_modelNodes.addColumnChangeSignal(0, &QUaNode::displayNameChanged);
+    // only variables have these signals, other nodes are ignored
+    m_modelNodes.addColumnChangeSignal(2, &QUaBaseVariable::valueChanged);
+    m_modelNodes.addColumnChangeSignal(3, &QUaBaseVariable::sourceTimestampChanged);
+    m_modelNodes.addColumnChangeSignal(4, &QUaBaseVariable::serverTimestampChanged);
+    // cache expensive string conversions, only recomputed on change
+    // NOTE : node id never changes, so column 1 needs no change signal
+    m_modelNodes.setColumnCached(0);
+    m_modelNodes.setColumnCached(1);
+    m_modelNodes.setColumnCached(3);
+    m_modelNodes.setColumnCached(4);
 
     // setup tree editors
     ui->treeViewNodes->setColumnEditor(2,
@@ -204,6 +204,7 @@ void Dialog::setupTreeCategories()
     ui->treeViewCategories->setSelectionMode(QAbstractItemView::ExtendedSelection);
     ui->treeViewCategories->setDeleteCallback(
     [this](QList<QUaNode*> &nodes) {
+        QList<QUaNode*> nodesToRemove;
         while (!nodes.isEmpty())
         {
             auto node = nodes.takeFirst();
@@ -218,9 +219,10 @@ void Dialog::setupTreeCategories()
                 }
                 continue;
             }
-            // NOTE : removed from model, not deleted
-            m_modelCategories.removeNode(node);
+            nodesToRemove << node;
         }
+        // NOTE : removed from model, not deleted
+        m_modelCategories.removeNodes(nodesToRemove);
     });
 
     // support clear in tree context menu
@@ -51,14 +51,29 @@ public:
     typename std::enable_if<!std::is_pointer<X>::value, bool>::type
     removeNode(N* node);
 
+    // NOTE : rows are removed in contiguous ranges, one notification per range
+    template<typename X = N>
+    typename std::enable_if<std::is_pointer<X>::value, int>::type
+    removeNodes(const QList<N>& nodes);
+
+    template<typename X = N>
+    typename std::enable_if<!std::is_pointer<X>::value, int>::type
+    removeNodes(const QList<N*>& nodes);
+
     QStringList indexesToCategories(const QModelIndexList& indexes) const;
 
-    void clear();
+    void clear() override;
 
     // Qt required API:
 
     QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
 
+    bool removeRows(int row, int count, const QModelIndex& parent = QModelIndex()) override;
+
+protected:
+    // adds categories
+    void addToMemoryReport(QUaModelMemoryReport& report) const override;
+
 private:
     QHash<
         typename QUaModel<N, I>::QUaNodeWrapper*,
@@ -106,8 +121,8 @@ inline void QUaCategoryModel<N, I>::removeCategory(const QString& strCategory)
     {
         return;
     }
-    int idx = root->children().indexOf(category);
-    Q_ASSERT(idx >= 0);
+    int idx = category->row();
+    Q_ASSERT(idx >= 0 && root->children().at(idx) == category);
     if (idx < 0)
     {
         return;
@@ -139,7 +154,7 @@ inline void QUaCategoryModel<N, I>::addNodeToCategory(const QString& strCategory
     auto category = this->addCategoryInternal(strCategory);
     Q_CHECK_PTR(category);
     if (!category) { return; }
-    QModelIndex index = category->index();
+    QModelIndex index = this->indexFromWrapper(category);
     // get new child's row
     int row = category->children().count();
     // notify views that row will be added
@@ -152,27 +167,31 @@ inline void QUaCategoryModel<N, I>::addNodeToCategory(const QString& strCategory
     );
     // apprend to parent's children list
     category->children() << wrapper;
+    // store new row, no other rows are affected
+    this->reindexChildren(category, row);
+    this->indexNodes(wrapper, false);
     // notify views that row addition has finished
     this->endInsertRows();
-    // force index creation (indirectly)
-    // because sometimes they are not created until a view requires them
-    // and if a child is added and parent's index is not ready then crash
-    bool indexOk = this->checkIndex(this->index(row, 0, index), QAbstractItemModel::CheckIndexOption::IndexIsValid);
-    Q_ASSERT(indexOk);
-    Q_UNUSED(indexOk);
+    // debug only
+    this->debugCheckIndex(this->indexFromWrapper(wrapper));
     // bind callback for data change on each column
     this->bindChangeCallbackForAllColumns(wrapper, false);
     // subscribe to instance removed
-    auto conn = QUaModelItemTraits::DestroyCallback<N, I>(wrapper->node(),
-        [this, wrapper]() {
-            Q_CHECK_PTR(wrapper);
-            auto root = QUaModel<N, I>::m_root;
-            Q_CHECK_PTR(root);
-            Q_UNUSED(root);
-            // remove
-            this->removeWrapper(wrapper);
-        }
-    );
+    QMetaObject::Connection conn;
+    {
+        QUaModelStatsTimer timer(this->statsTraitCalls(), this->statsTraitNsecs(), "DestroyCallback");
+        conn = QUaModelItemTraits::DestroyCallback<N, I>(wrapper->node(),
+            [this, wrapper]() {
+                Q_CHECK_PTR(wrapper);
+                auto root = QUaModel<N, I>::m_root;
+                Q_CHECK_PTR(root);
+                Q_UNUSED(root);
+                // detach so wrapper no longer points to node, then remove right away
+                this->detachWrapper(wrapper);
+                this->removeWrapper(wrapper);
+            }
+        );
+    }
     if (conn)
     {
         // NOTE : QUaNodeWrapper destructor removes connections
@@ -258,20 +277,13 @@ inline
 typename std::enable_if<std::is_pointer<X>::value, bool>::type
 QUaCategoryModel<N, I>::removeNode(N node)
 {
-    bool res = false;
-    // look for node in all categories
-    auto& categories = QUaModel<N, I>::m_root->children();
-    for (auto category : categories)
+    // NOTE : hashed lookup of node in all categories, no search
+    auto wrappers = this->wrappersFromNode(node);
+    for (auto wrapper : wrappers)
     {
-        auto wrapper = category->childByNode(node);
-        if (!wrapper)
-        {
-            continue;
-        }
         this->removeWrapper(wrapper);
-        res = true;
     }
-    return res;
+    return !wrappers.isEmpty();
 }
 
 template<typename N, int I>
@@ -280,20 +292,70 @@ inline
 typename std::enable_if<!std::is_pointer<X>::value, bool>::type 
 QUaCategoryModel<N, I>::removeNode(N* node)
 {
-    bool res = false;
-    // look for node in all categories
-    auto& categories = QUaModel<N, I>::m_root->children();
-    for (auto category : categories)
+    // NOTE : hashed lookup of node in all categories, no search, but index 
+    //        matches by content (IsEqual) so only remove this instance
+    bool removed = false;
+    for (auto wrapper : this->wrappersFromNode(node))
     {
-        auto wrapper = category->childByNode(node);
-        if (!wrapper)
+        if (wrapper->node() != node)
         {
             continue;
         }
         this->removeWrapper(wrapper);
-        res = true;
+        removed = true;
+    }
+    return removed;
+}
+
+template<typename N, int I>
+template<typename X>
+inline 
+typename std::enable_if<std::is_pointer<X>::value, int>::type 
+QUaCategoryModel<N, I>::removeNodes(const QList<N>& nodes)
+{
+    // NOTE : hashed lookup of nodes in all categories, no search
+    QList<typename QUaModel<N, I>::QUaNodeWrapper*> wrappers;
+    QSet<typename QUaModel<N, I>::QUaNodeWrapper*> setWrappers;
+    for (auto node : nodes)
+    {
+        for (auto wrapper : this->wrappersFromNode(node))
+        {
+            if (setWrappers.contains(wrapper))
+            {
+                continue;
+            }
+            setWrappers.insert(wrapper);
+            wrappers << wrapper;
+        }
+    }
+    this->removeWrappers(wrappers);
+    return wrappers.count();
+}
+
+template<typename N, int I>
+template<typename X>
+inline 
+typename std::enable_if<!std::is_pointer<X>::value, int>::type 
+QUaCategoryModel<N, I>::removeNodes(const QList<N*>& nodes)
+{
+    // NOTE : hashed lookup of nodes in all categories, no search, but index 
+    //        matches by content (IsEqual) so only remove these instances
+    QList<typename QUaModel<N, I>::QUaNodeWrapper*> wrappers;
+    QSet<typename QUaModel<N, I>::QUaNodeWrapper*> setWrappers;
+    for (auto node : nodes)
+    {
+        for (auto wrapper : this->wrappersFromNode(node))
+        {
+            if (wrapper->node() != node || setWrappers.contains(wrapper))
+            {
+                continue;
+            }
+            setWrappers.insert(wrapper);
+            wrappers << wrapper;
+        }
     }
-    return res;
+    this->removeWrappers(wrappers);
+    return wrappers.count();
 }
 
 template<typename N, int I>
@@ -333,6 +395,7 @@ inline QVariant QUaCategoryModel<N, I>::data(
     const QModelIndex& index, 
     int role) const
 {
+    this->countDataCall(index.column(), role);
     // early exit for inhandled cases
     if (!QUaModel<N, I>::m_root || !index.isValid())
     {
@@ -358,23 +421,25 @@ inline QVariant QUaCategoryModel<N, I>::data(
         return QVariant();
     }
     // default implementation if no ColumnDataSource has been defined
-    if (QUaModelBase<N, I>::m_mapDataSourceFuncs.isEmpty())
+    if (QUaModelBase<N, I>::m_vectDataSourceFuncs.isEmpty())
     {
         using QUaModel = QUaModel<N, I>;
         Q_ASSERT(QUaModel::m_columnCount == 1);
         return QObject::tr("");
     }
     // empty if no ColumnDataSource defined for this column
-    if (!QUaModelBase<N, I>::m_mapDataSourceFuncs.contains(index.column()) ||
-        !QUaModelBase<N, I>::m_mapDataSourceFuncs[index.column()].m_dataCallback)
+    auto source = this->columnDataSource(index.column());
+    if (!source || !source->m_dataCallback)
+    {
+        return QVariant();
+    }
+    // empty if role not served by this column
+    if (!source->m_roles.contains(role))
     {
         return QVariant();
     }
     // use user-defined ColumnDataSource
-    return QUaModelBase<N, I>::m_mapDataSourceFuncs[index.column()].m_dataCallback(
-        wrapper->node(),
-        static_cast<Qt::ItemDataRole>(role)
-    );
+    return this->columnData(source, wrapper, index.column(), role);
 }
 
 template<typename N, int I>
@@ -389,7 +454,7 @@ QUaCategoryModel<N, I>::addCategoryInternal(const QString& strCategory)
     {
         return wrapper;
     }
-    QModelIndex index = root->index();
+    QModelIndex index = this->indexFromWrapper(root);
     // get new child's row
     int row = root->children().count();
     // notify views that row will be added
@@ -403,6 +468,8 @@ QUaCategoryModel<N, I>::addCategoryInternal(const QString& strCategory)
     );
     // apprend to parent's children list
     root->children() << wrapper;
+    // store new row, no other rows are affected
+    this->reindexChildren(root, row);
     // bind to string
     m_hashCategories[wrapper] = strCategory;
     // notify views that row addition has finished
@@ -421,17 +488,39 @@ QUaCategoryModel<N, I>::getCategoryInternal(const QString& strCategory)
 }
 
 template<typename N, int I>
-inline void QUaCategoryModel<N, I>::clear()
+inline bool QUaCategoryModel<N, I>::removeRows(int row, int count, const QModelIndex& parent)
 {
-    this->beginResetModel();
-    while (QUaModel<N, I>::m_root->children().count() > 0)
+    // top level rows are categories, forget them before wrappers are deleted
+    if (!parent.isValid() && row >= 0 && count > 0 && 
+        row + count <= QUaModel<N, I>::m_root->children().count())
     {
-        auto wrapper = QUaModel<N, I>::m_root->children().takeFirst();
-        // NOTE : QUaNodeWrapper destructor removes connections
-        delete wrapper;
+        auto categories = QUaModel<N, I>::m_root->children().mid(row, count);
+        for (auto category : categories)
+        {
+            m_hashCategories.remove(category);
+        }
     }
+    return QUaTreeModel<N, I>::removeRows(row, count, parent);
+}
+
+template<typename N, int I>
+inline void QUaCategoryModel<N, I>::addToMemoryReport(QUaModelMemoryReport& report) const
+{
+    QUaTreeModel<N, I>::addToMemoryReport(report);
+    quint64 bytes = QUaModelMemoryReport::hashBytes(m_hashCategories);
+    for (auto& strCategory : m_hashCategories)
+    {
+        bytes += QUaModelMemoryReport::stringBytes(strCategory);
+    }
+    report.bytes["categories"] = bytes;
+}
+
+template<typename N, int I>
+inline void QUaCategoryModel<N, I>::clear()
+{
+    // NOTE : tree model also discards its pending inserts
+    QUaTreeModel<N, I>::clear();
     m_hashCategories.clear();
-    this->endResetModel();
 }
 
 #endif // QUACATEGORYMODEL_H
@@ -25,6 +25,18 @@ QUaModelItemTraits::IsEqual<QUaLog>(const QUaLog* node1, const QUaLog* node2)
         node1->timestamp == node2->timestamp;
 }
 
+template<>
+inline uint
+QUaModelItemTraits::Hash<QUaLog>(const QUaLog* node)
+{
+    // NOTE : same fields as IsEqual
+    return 
+        qHash(node->message) ^
+        qHash(node->timestamp) ^
+        (qHash(static_cast<int>(node->level)) << 8) ^
+        (qHash(static_cast<int>(node->category)) << 16);
+}
+
 inline bool operator==(const QUaLog& node1, const QUaLog& node2)
 {
     return QUaModelItemTraits::IsEqual<QUaLog>(&node1, &node2);
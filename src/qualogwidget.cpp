@@ -196,6 +196,34 @@ void QUaLogWidget::setClearVisible(const bool& visible)
     this->updateSpacerLabelVisible();
 }
 
+QUaModelMemoryReport QUaLogWidget::memoryReport() const
+{
+    QUaModelMemoryReport report = m_modelLogs.memoryReport();
+    quint64 messages = 0;
+    for (auto log : m_logsByDate)
+    {
+        messages += sizeof(QUaLog) + QUaModelMemoryReport::ContainerHeaderBytes + log->message.capacity();
+    }
+    report.bytes["logMessages"    ] = messages;
+    report.bytes["logsByDate"     ] = QUaModelMemoryReport::mapBytes(m_logsByDate);
+    report.bytes["logsToHighlight"] = QUaModelMemoryReport::setBytes(m_logsToHighlight);
+    return report;
+}
+
+bool QUaLogWidget::isMemoryOverlayVisible() const
+{
+    return ui->treeViewLog->memoryOverlay();
+}
+
+void QUaLogWidget::setMemoryOverlayVisible(const bool& visible)
+{
+    // NOTE : overlay shows the whole log store, not only the model
+    ui->treeViewLog->setMemoryReportCallback([this]() {
+        return this->memoryReport();
+    });
+    ui->treeViewLog->setMemoryOverlay(visible);
+}
+
 void QUaLogWidget::updateSpacerLabelVisible()
 {
     bool visible =
@@ -250,7 +278,7 @@ void QUaLogWidget::setupTable()
             return m_logsToPaintByLevel[log->level];
         }
 		return QVariant();
-    }/* other callbacks for data that changes or editable */);
+    }, nullptr, nullptr, QVector<int>() << Qt::DisplayRole << Qt::FontRole << Qt::ForegroundRole);
     int levelColumn = static_cast<int>(Columns::Level);
     m_modelLogs.setColumnDataSource(levelColumn, QUaLogWidget::m_columnsMetaEnum.valueToKey(levelColumn),
     [this](QUaLog* log, const Qt::ItemDataRole& role) -> QVariant {
@@ -269,7 +297,7 @@ void QUaLogWidget::setupTable()
             return m_logsToPaintByLevel[log->level];
         }
 		return QVariant();
-    }/* other callbacks for data that changes or editable */);
+    }, nullptr, nullptr, QVector<int>() << Qt::DisplayRole << Qt::FontRole << Qt::ForegroundRole);
     int categoryColumn = static_cast<int>(Columns::Category);
     m_modelLogs.setColumnDataSource(categoryColumn, QUaLogWidget::m_columnsMetaEnum.valueToKey(categoryColumn),
     [this](QUaLog* log, const Qt::ItemDataRole& role) -> QVariant {
@@ -288,7 +316,7 @@ void QUaLogWidget::setupTable()
             return m_logsToPaintByLevel[log->level];
         }
 		return QVariant();
-    }/* other callbacks for data that changes or editable */);
+    }, nullptr, nullptr, QVector<int>() << Qt::DisplayRole << Qt::FontRole << Qt::ForegroundRole);
     int messageColumn = static_cast<int>(Columns::Message);
     m_modelLogs.setColumnDataSource(messageColumn, QUaLogWidget::m_columnsMetaEnum.valueToKey(messageColumn),
     [this](QUaLog* log, const Qt::ItemDataRole& role) -> QVariant {
@@ -315,20 +343,21 @@ void QUaLogWidget::setupTable()
             return m_logsToPaintByLevel[log->level];
         }
 		return QVariant();
-    });
+    }, nullptr, nullptr, QVector<int>() << Qt::DisplayRole << Qt::FontRole << Qt::ForegroundRole);
     // support delete and copy
     ui->treeViewLog->setSelectionBehavior(QAbstractItemView::SelectRows);
     ui->treeViewLog->setSelectionMode(QAbstractItemView::ExtendedSelection);
     ui->treeViewLog->setDeleteCallback(
     [this](QList<QUaLog*> &logs) {
-        while (logs.count() > 0)
+        // NOTE : logs live in model, forget them before removing
+        for (auto log : logs)
         {
-            auto log = logs.takeFirst();
             m_logsToHighlight.remove(log);
             Q_ASSERT(m_logsByDate.contains(log->timestamp, log));
             m_logsByDate.remove(log->timestamp, log);
-            m_modelLogs.removeNode(log);
         }
+        m_modelLogs.removeNodes(logs);
+        logs.clear();
         Q_ASSERT(m_modelLogs.count() == m_logsByDate.size());
     });
     ui->treeViewLog->setCopyCallback(
@@ -378,18 +407,22 @@ void QUaLogWidget::setupTable()
 
 void QUaLogWidget::enforceMaxEntries()
 {
+    // oldest first, removed from model all at once
+    QList<QUaLog*> logs;
     while (static_cast<quint32>(m_logsByDate.size()) > m_maxEntries)
     {
         auto begin = m_logsByDate.begin();
-        m_modelLogs.removeNode(begin.value());
+        logs << begin.value();
         m_logsToHighlight.remove(begin.value());
         m_logsByDate.erase(begin);
     }
+    m_modelLogs.removeNodes(logs);
     Q_ASSERT(m_modelLogs.count() == m_logsByDate.size());
 }
 
 void QUaLogWidget::purgeLogs()
 {
+    QList<QUaLog*> logs;
     auto iter = m_logsByDate.begin();
     while(iter != m_logsByDate.end())
     {
@@ -400,10 +433,11 @@ void QUaLogWidget::purgeLogs()
         {
             continue;
         }
-        m_modelLogs.removeNode(log);
+        logs << log;
         m_logsToHighlight.remove(log);
         m_logsByDate.remove(timestamp, log);
     };
+    m_modelLogs.removeNodes(logs);
 }
 
 void QUaLogWidget::on_pushButtonClear_clicked()
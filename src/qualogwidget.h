@@ -93,6 +93,13 @@ public:
     bool isClearVisible() const;
     void setClearVisible(const bool& visible);
 
+    // estimated memory of the log store (model, messages and indexes)
+    QUaModelMemoryReport memoryReport() const;
+
+    // debug overlay drawn on top of the log view
+    bool isMemoryOverlayVisible() const;
+    void setMemoryOverlayVisible(const bool& visible);
+
 public slots:
     void addLog(const QUaLog& log);
 
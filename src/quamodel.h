@@ -2,11 +2,22 @@
 #define QUANODEMODEL_H
 
 #include <QQueue>
+#include <QSet>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QMetaMethod>
+#include <QPointer>
+#include <QCoreApplication>
 #include <QAbstractItemModel>
 #include <QSortFilterProxyModel>
 #include <QUaModelItemTraits>
+#include <QUaModelTracer>
 
 #include <functional>
+#include <type_traits>
+#include <cstddef>
+#include <algorithm>
+#include <atomic>
 
 // NOTE : neede to emit Qt events from templated classes because
 // templated classes cannot inherit or be QObjects
@@ -14,10 +25,20 @@ class QUaModelBaseEventer : public QObject
 {
 	Q_OBJECT
 public:
+	// NOTE : higher priority tasks always run first, idle tasks only run
+	//        when the event loop has nothing else to process
+	enum class Priority
+	{
+		Structural = 0,
+		Data       = 1,
+		Idle       = 2
+	};
+
 	inline explicit QUaModelBaseEventer(QObject* parent = nullptr)
 		: QObject(parent)
 	{
 		m_processing = false;
+		m_budget     = 4;
 		QObject::connect(
 			this,
 			&QUaModelBaseEventer::sendEvent,
@@ -25,36 +46,660 @@ public:
 			&QUaModelBaseEventer::on_sendEvent,
 			Qt::QueuedConnection
 		);
+		// NOTE : zero timers time out once all pending events are processed
+		m_timerIdle.setSingleShot(true);
+		m_timerIdle.setInterval(0);
+		QObject::connect(
+			&m_timerIdle,
+			&QTimer::timeout,
+			this,
+			&QUaModelBaseEventer::on_idle
+		);
 	};
 	template <typename M1 = const std::function<void(void)>&>
-	inline void execLater(M1 func)
+	inline void execLater(M1 func, const Priority& priority = Priority::Structural)
 	{
-		m_funcs.enqueue(func);
-		if (m_processing)
-		{
-			return;
-		}
-		m_processing = true;
-		emit this->sendEvent(QPrivateSignal());
+		m_funcs[static_cast<int>(priority)].enqueue(func);
+		this->schedule();
+	};
+	// max milliseconds spent draining tasks per event loop iteration
+	// NOTE : at least one task is run per iteration, 0 means no limit
+	inline int budget() const
+	{
+		return m_budget;
+	};
+	inline void setBudget(const int& budget)
+	{
+		m_budget = qMax(0, budget);
+	};
+	inline int pendingCount() const
+	{
+		return m_funcs[0].count() + m_funcs[1].count() + m_funcs[2].count();
 	};
 Q_SIGNALS:
 	void nodeAdded(void* wrapper);
+	void nodeChanged(void* wrapper, int column);
+	// NOTE : only emitted by tree models in incremental population mode
+	void populationProgress(int populated, int pending);
 	void sendEvent(QPrivateSignal);
+	// NOTE : emitted from producer threads, always queued to eventer's thread
+	void mutationsPosted();
 private Q_SLOTS:
 	inline void on_sendEvent() 
 	{
 		Q_ASSERT(m_processing);
-		if (m_funcs.isEmpty())
+		m_processing = false;
+		this->runBatch(Priority::Data);
+		this->schedule();
+	};
+	inline void on_idle()
+	{
+		// busy again, let higher priority tasks go first
+		if (!this->hasPending(Priority::Data))
 		{
-			m_processing = false;
-			return;
+			this->runBatch(Priority::Idle);
 		}
-		m_funcs.dequeue()();
-		Q_EMIT this->sendEvent(QPrivateSignal());
+		this->schedule();
 	};
 private:
 	bool m_processing;
-	QQueue<std::function<void(void)>> m_funcs;
+	int  m_budget;
+	QTimer m_timerIdle;
+	QQueue<std::function<void(void)>> m_funcs[3];
+
+	inline bool hasPending(const Priority& lowest) const
+	{
+		for (int i = 0; i <= static_cast<int>(lowest); i++)
+		{
+			if (!m_funcs[i].isEmpty())
+			{
+				return true;
+			}
+		}
+		return false;
+	};
+	inline void schedule()
+	{
+		if (this->hasPending(Priority::Data))
+		{
+			if (m_processing)
+			{
+				return;
+			}
+			m_processing = true;
+			Q_EMIT this->sendEvent(QPrivateSignal());
+			return;
+		}
+		if (!m_funcs[static_cast<int>(Priority::Idle)].isEmpty() && !m_timerIdle.isActive())
+		{
+			m_timerIdle.start();
+		}
+	};
+	// run highest priority tasks first until budget is consumed
+	// NOTE : tasks queued while running are considered in the same batch
+	inline void runBatch(const Priority& lowest)
+	{
+		QElapsedTimer timer;
+		timer.start();
+		do
+		{
+			int i = 0;
+			while (i <= static_cast<int>(lowest) && m_funcs[i].isEmpty())
+			{
+				i++;
+			}
+			if (i > static_cast<int>(lowest))
+			{
+				return;
+			}
+			// NOTE : dequeue before call, task might queue more tasks
+			auto func = m_funcs[i].dequeue();
+			func();
+		} while (m_budget == 0 || timer.elapsed() < m_budget);
+	};
+};
+
+// NOTE : keeps a single connection per (sender, signal) no matter how many
+//        wrappers, columns or models are interested, then dispatches to 
+//        all subscribers, subscriptions are removed per subscriber (wrapper)
+//        and optionally per tag (column)
+class QUaSignalHub : public QObject
+{
+	Q_OBJECT
+public:
+	// NOTE : owned by the application object, so it is destroyed before 
+	//        static teardown, senders are disconnected when it is deleted
+	inline static QUaSignalHub* instance()
+	{
+		static QPointer<QUaSignalHub> hub;
+		if (!hub)
+		{
+			hub = new QUaSignalHub(QCoreApplication::instance());
+		}
+		return hub;
+	};
+
+	template<typename Func>
+	inline void subscribe(
+		const typename QtPrivate::FunctionPointer<Func>::Object* sender,
+		Func signal,
+		const void* subscriber,
+		const std::function<void(void)>& callback,
+		const int& tag = -1
+	)
+	{
+		Q_CHECK_PTR(sender);
+		Key key = qMakePair(
+			static_cast<const QObject*>(sender), 
+			QMetaMethod::fromSignal(signal).methodIndex()
+		);
+		auto& entry = m_hashEntries[key];
+		// NOTE : connection is invalid if new or if sender was destroyed
+		if (!entry.m_connection)
+		{
+			entry.m_subscribers.clear();
+			entry.m_connection = QObject::connect(sender, signal, this,
+			[this, key]() {
+				this->dispatch(key);
+			});
+		}
+		Subscriber sub;
+		sub.m_subscriber = subscriber;
+		sub.m_tag        = tag;
+		sub.m_callback   = callback;
+		entry.m_subscribers << sub;
+		m_hashKeys[subscriber] << key;
+	};
+
+	// remove subscriptions of subscriber made with tag, all if tag is negative
+	inline void unsubscribe(const void* subscriber, const int& tag = -1)
+	{
+		auto keys = m_hashKeys.take(subscriber);
+		QList<Key> keysLeft;
+		for (auto& key : keys)
+		{
+			auto it = m_hashEntries.find(key);
+			if (it == m_hashEntries.end())
+			{
+				continue;
+			}
+			auto& subscribers = it->m_subscribers;
+			bool hasOtherTags = false;
+			subscribers.erase(std::remove_if(subscribers.begin(), subscribers.end(),
+			[subscriber, tag, &hasOtherTags](const Subscriber& sub) {
+				if (sub.m_subscriber != subscriber)
+				{
+					return false;
+				}
+				if (tag >= 0 && sub.m_tag != tag)
+				{
+					hasOtherTags = true;
+					return false;
+				}
+				return true;
+			}), subscribers.end());
+			if (hasOtherTags && !keysLeft.contains(key))
+			{
+				keysLeft << key;
+			}
+			if (!subscribers.isEmpty())
+			{
+				continue;
+			}
+			// last subscriber gone, drop connection
+			QObject::disconnect(it->m_connection);
+			m_hashEntries.erase(it);
+		}
+		if (!keysLeft.isEmpty())
+		{
+			m_hashKeys.insert(subscriber, keysLeft);
+		}
+	};
+
+	// number of (sender, signal) connections currently held
+	inline int connectionCount() const
+	{
+		return m_hashEntries.count();
+	};
+
+private:
+	inline explicit QUaSignalHub(QObject* parent = nullptr)
+		: QObject(parent)
+	{};
+	typedef QPair<const QObject*, int> Key;
+	struct Subscriber
+	{
+		const void* m_subscriber;
+		int m_tag;
+		std::function<void(void)> m_callback;
+	};
+	struct Entry
+	{
+		QMetaObject::Connection m_connection;
+		QList<Subscriber> m_subscribers;
+	};
+	QHash<Key, Entry> m_hashEntries;
+	QHash<const void*, QList<Key>> m_hashKeys;
+
+	inline void dispatch(const Key& key)
+	{
+		auto it = m_hashEntries.constFind(key);
+		if (it == m_hashEntries.constEnd())
+		{
+			return;
+		}
+		// NOTE : copy (cheap, implicitly shared) in case a callback unsubscribes
+		auto subscribers = it->m_subscribers;
+		for (auto& sub : subscribers)
+		{
+			sub.m_callback();
+		}
+	};
+};
+
+// NOTE : fixed size block allocator, blocks are carved from large slabs
+//        to avoid one heap allocation (and its header) per block, 
+//        all blocks of same size and alignment share the same pool,
+//        not thread safe (models only live in the gui thread)
+// NOTE : the pool is process wide, not a per model arena, because wrappers 
+//        build their sub-trees without a model reference, so slabs are only
+//        returned to the heap once no model holds a wrapper
+template<std::size_t S, std::size_t A>
+class QUaModelSlabPool
+{
+public:
+	inline static void* allocate()
+	{
+		auto& pool = QUaModelSlabPool<S, A>::instance();
+		if (!pool.m_free)
+		{
+			pool.addSlab();
+		}
+		Block* block = pool.m_free;
+		pool.m_free  = block->m_next;
+		pool.m_used++;
+		return block;
+	};
+	inline static void release(void* ptr)
+	{
+		if (!ptr)
+		{
+			return;
+		}
+		auto& pool = QUaModelSlabPool<S, A>::instance();
+		Block* block = static_cast<Block*>(ptr);
+		block->m_next = pool.m_free;
+		pool.m_free   = block;
+		pool.m_used--;
+		// return whole slabs to the heap once no block is used,
+		// but keep one to avoid thrashing on single add/remove cycles
+		if (pool.m_used == 0 && pool.m_slabs.count() > 1)
+		{
+			pool.releaseSlabs(1);
+		}
+	};
+	// return many blocks at once (e.g. a whole sub-tree), already destroyed
+	template<typename C>
+	inline static void releaseAll(const C& ptrs)
+	{
+		if (ptrs.isEmpty())
+		{
+			return;
+		}
+		auto& pool = QUaModelSlabPool<S, A>::instance();
+		for (auto ptr : ptrs)
+		{
+			Block* block = reinterpret_cast<Block*>(ptr);
+			block->m_next = pool.m_free;
+			pool.m_free   = block;
+		}
+		Q_ASSERT(pool.m_used >= static_cast<std::size_t>(ptrs.count()));
+		pool.m_used -= static_cast<std::size_t>(ptrs.count());
+		if (pool.m_used == 0 && pool.m_slabs.count() > 1)
+		{
+			pool.releaseSlabs(1);
+		}
+	};
+	inline static std::size_t blockSize()
+	{
+		return sizeof(Block);
+	};
+	inline static std::size_t usedBlocks()
+	{
+		return QUaModelSlabPool<S, A>::instance().m_used;
+	};
+	inline static std::size_t reservedBytes()
+	{
+		return static_cast<std::size_t>(QUaModelSlabPool<S, A>::instance().m_slabs.count()) *
+			SlabBlocks * sizeof(Block);
+	};
+private:
+	union Block
+	{
+		Block* m_next;
+		typename std::aligned_storage<S, A>::type m_data;
+	};
+	static const int SlabBlocks = 1024;
+	Block* m_free;
+	std::size_t m_used;
+	QVector<Block*> m_slabs;
+	inline QUaModelSlabPool() : m_free(nullptr), m_used(0) {};
+	inline ~QUaModelSlabPool()
+	{
+		// NOTE : leak rather than free blocks still in use at exit
+		if (m_used == 0)
+		{
+			this->releaseSlabs(0);
+		}
+	};
+	inline static QUaModelSlabPool<S, A>& instance()
+	{
+		static QUaModelSlabPool<S, A> pool;
+		return pool;
+	};
+	inline void addSlab()
+	{
+		Block* slab = new Block[SlabBlocks];
+		for (int i = 0; i < SlabBlocks - 1; i++)
+		{
+			slab[i].m_next = &slab[i + 1];
+		}
+		slab[SlabBlocks - 1].m_next = m_free;
+		m_free = slab;
+		m_slabs << slab;
+	};
+	// NOTE : only call if no block is used
+	inline void releaseSlabs(const int& keep)
+	{
+		Q_ASSERT(m_used == 0);
+		while (m_slabs.count() > keep)
+		{
+			delete[] m_slabs.takeLast();
+		}
+		m_free = nullptr;
+		for (auto slab : m_slabs)
+		{
+			for (int i = 0; i < SlabBlocks - 1; i++)
+			{
+				slab[i].m_next = &slab[i + 1];
+			}
+			slab[SlabBlocks - 1].m_next = m_free;
+			m_free = slab;
+		}
+	};
+};
+
+// set of roles served by a column, empty means all roles
+class QUaModelColumnRoles
+{
+public:
+	inline QUaModelColumnRoles(const QVector<int>& roles = QVector<int>())
+		: m_roles(roles), m_mask(0)
+	{
+		for (auto role : m_roles)
+		{
+			m_mask |= role >= 0 && role < 64 ? (Q_UINT64_C(1) << role) : 0;
+		}
+	};
+	inline bool isEmpty() const
+	{
+		return m_roles.isEmpty();
+	};
+	inline const QVector<int>& roles() const
+	{
+		return m_roles;
+	};
+	// NOTE : standard roles are tested with a bit mask, no search
+	inline bool contains(const int& role) const
+	{
+		if (m_roles.isEmpty())
+		{
+			return true;
+		}
+		return role >= 0 && role < 64 ? 
+			(m_mask & (Q_UINT64_C(1) << role)) != 0 : 
+			m_roles.contains(role);
+	};
+private:
+	QVector<int> m_roles;
+	quint64 m_mask;
+};
+
+// NOTE : unbounded multi producer single consumer queue (Vyukov), push
+//        can be called from any thread without locks, pop only from the
+//        consumer thread (the thread the model lives in)
+template<typename T>
+class QUaModelMpscQueue
+{
+public:
+	inline QUaModelMpscQueue()
+	{
+		// NOTE : head and tail start at a stub, never empty list
+		Node* stub = new Node();
+		m_head.store(stub, std::memory_order_relaxed);
+		m_tail = stub;
+	};
+	QUaModelMpscQueue(const QUaModelMpscQueue&) = delete;
+	inline ~QUaModelMpscQueue()
+	{
+		T value;
+		while (this->pop(value))
+		{
+		}
+		delete m_tail;
+	};
+	// thread safe
+	inline void push(const T& value)
+	{
+		Node* node = new Node();
+		node->m_value = value;
+		// NOTE : producers only contend on the exchange
+		Node* prev = m_head.exchange(node, std::memory_order_acq_rel);
+		prev->m_next.store(node, std::memory_order_release);
+	};
+	// consumer thread only, false if empty (or producer in the middle of push)
+	inline bool pop(T& value)
+	{
+		Node* tail = m_tail;
+		Node* next = tail->m_next.load(std::memory_order_acquire);
+		if (!next)
+		{
+			return false;
+		}
+		value  = next->m_value;
+		// next becomes the new stub
+		m_tail = next;
+		delete tail;
+		return true;
+	};
+	// consumer thread only
+	inline bool isEmpty() const
+	{
+		return !m_tail->m_next.load(std::memory_order_acquire);
+	};
+private:
+	struct Node
+	{
+		inline Node() : m_next(nullptr), m_value() {};
+		std::atomic<Node*> m_next;
+		T m_value;
+	};
+	std::atomic<Node*> m_head;
+	Node* m_tail;
+};
+
+// snapshot of model's performance counters (see QUaModel::stats)
+// NOTE : times are in nanoseconds, callbacks are the user's column callbacks
+//        (data, change binding, editable), traits are the QUaModelItemTraits 
+//        calls made by the model (children, set data, validity checks and
+//        destroy, new child and move subscriptions)
+struct QUaModelStats
+{
+	inline QUaModelStats() :
+		rowsInserted(0), insertNotifications(0),
+		rowsRemoved(0), removeNotifications(0),
+		resets(0), dataChangedNotifications(0),
+		indexCalls(0), parentCalls(0), dataCalls(0),
+		callbackCalls(0), callbackNsecs(0),
+		traitCalls(0), traitNsecs(0),
+		wrappers(0), liveConnections(0), hubConnections(0)
+	{};
+	quint64 rowsInserted;
+	quint64 insertNotifications;
+	quint64 rowsRemoved;
+	quint64 removeNotifications;
+	quint64 resets;
+	quint64 dataChangedNotifications;
+	quint64 indexCalls;
+	quint64 parentCalls;
+	quint64 dataCalls;
+	// (column, role) to number of data() calls
+	QHash<QPair<int, int>, quint64> dataCallsByColumnRole;
+	quint64 callbackCalls;
+	quint64 callbackNsecs;
+	quint64 traitCalls;
+	quint64 traitNsecs;
+	// computed when snapshot is taken
+	int wrappers;
+	int liveConnections;
+	int hubConnections;
+};
+
+// adds elapsed time to counters on destruction, does nothing if nullptr
+// NOTE : used in a scope around user callbacks and traits calls, also 
+//        adds a trace event named traceName if QUaModelTracer enabled and
+//        marks traceName as running operation for QUaModelWatchdog
+class QUaModelStatsTimer
+{
+public:
+	inline explicit QUaModelStatsTimer(quint64* calls, quint64* nsecs, const char* traceName)
+		: m_operation(traceName), m_calls(calls), m_nsecs(nsecs), m_traceName(traceName), m_traceStart(-1)
+	{
+		if (m_nsecs)
+		{
+			m_timer.start();
+		}
+		if (QUaModelTracer::isEnabled())
+		{
+			m_traceStart = QUaModelTracer::instance()->now();
+		}
+	};
+	QUaModelStatsTimer(const QUaModelStatsTimer&) = delete;
+	inline ~QUaModelStatsTimer()
+	{
+		if (m_traceStart >= 0)
+		{
+			auto tracer = QUaModelTracer::instance();
+			tracer->complete(m_traceName, "callback", m_traceStart, tracer->now());
+		}
+		if (!m_nsecs)
+		{
+			return;
+		}
+		*m_nsecs += static_cast<quint64>(m_timer.nsecsElapsed());
+		(*m_calls)++;
+	};
+private:
+	QUaModelOperationScope m_operation;
+	quint64* m_calls;
+	quint64* m_nsecs;
+	const char* m_traceName;
+	qint64 m_traceStart;
+	QElapsedTimer m_timer;
+};
+
+// memory footprint of a model (see QUaModel::memoryReport)
+// NOTE : bytes are estimated from element counts and Qt 5 container layouts,
+//        good enough to find which structure grows, not exact allocations
+struct QUaModelMemoryReport
+{
+	inline QUaModelMemoryReport() :
+		wrappers(0), connections(0), cachedValues(0),
+		wrapperSize(0), wrapperBlockSize(0), poolUsedBlocks(0), poolReservedBytes(0)
+	{};
+	int wrappers;
+	int connections;
+	int cachedValues;
+	// exact, sizeof(QUaNodeWrapper) and state of the wrapper pool
+	// NOTE : pool is shared by all models with the same wrapper size
+	quint64 wrapperSize;
+	quint64 wrapperBlockSize;
+	quint64 poolUsedBlocks;
+	quint64 poolReservedBytes;
+	// structure name to estimated bytes
+	QMap<QString, quint64> bytes;
+
+	inline quint64 totalBytes() const
+	{
+		quint64 total = 0;
+		for (auto value : bytes)
+		{
+			total += value;
+		}
+		return total;
+	};
+	// one line per structure, for logging and debug overlays
+	inline QString toString() const
+	{
+		QString strReport = QString("wrappers : %1\nconnections : %2\ncached values : %3\n")
+			.arg(wrappers).arg(connections).arg(cachedValues);
+		strReport += QString("wrapper size : %1 bytes (%2 bytes block)\npool : %3 blocks used, %4 KiB reserved\n")
+			.arg(wrapperSize).arg(wrapperBlockSize).arg(poolUsedBlocks).arg(poolReservedBytes / 1024.0, 0, 'f', 1);
+		for (auto it = bytes.constBegin(); it != bytes.constEnd(); ++it)
+		{
+			strReport += QString("%1 : %2 KiB\n").arg(it.key()).arg(it.value() / 1024.0, 0, 'f', 1);
+		}
+		strReport += QString("total : %1 KiB").arg(this->totalBytes() / 1024.0, 0, 'f', 1);
+		return strReport;
+	};
+
+	// estimators
+	// NOTE : connection internals are private to Qt, approximate size
+	static const quint64 ConnectionBytes = 80;
+	static const quint64 ContainerHeaderBytes = 24;
+	template<typename T>
+	inline static quint64 listBytes(const QList<T>& list)
+	{
+		return list.isEmpty() ? 0 : 
+			ContainerHeaderBytes + static_cast<quint64>(list.count()) * 
+			// NOTE : elements larger than a pointer are heap allocated
+			(sizeof(T) > sizeof(void*) ? sizeof(void*) + sizeof(T) : sizeof(void*));
+	};
+	template<typename T>
+	inline static quint64 vectorBytes(const QVector<T>& vector)
+	{
+		return vector.capacity() == 0 ? 0 :
+			ContainerHeaderBytes + static_cast<quint64>(vector.capacity()) * sizeof(T);
+	};
+	template<typename K, typename V>
+	inline static quint64 hashBytes(const QHash<K, V>& hash)
+	{
+		// buckets plus one node (next, hash, key, value) per entry
+		return hash.isEmpty() ? 0 :
+			ContainerHeaderBytes + static_cast<quint64>(hash.capacity()) * sizeof(void*) +
+			static_cast<quint64>(hash.size()) * (sizeof(void*) + sizeof(uint) + sizeof(K) + sizeof(V));
+	};
+	template<typename T>
+	inline static quint64 setBytes(const QSet<T>& set)
+	{
+		// same as hash without value
+		return set.isEmpty() ? 0 :
+			ContainerHeaderBytes + static_cast<quint64>(set.capacity()) * sizeof(void*) +
+			static_cast<quint64>(set.size()) * (sizeof(void*) + sizeof(uint) + sizeof(T));
+	};
+	template<typename K, typename V>
+	inline static quint64 mapBytes(const QMap<K, V>& map)
+	{
+		// one red-black tree node (parent/color, left, right, key, value) per entry
+		return map.isEmpty() ? 0 :
+			ContainerHeaderBytes + static_cast<quint64>(map.size()) * 
+			(3 * sizeof(void*) + sizeof(K) + sizeof(V));
+	};
+	inline static quint64 stringBytes(const QString& string)
+	{
+		return string.isEmpty() ? 0 :
+			ContainerHeaderBytes + static_cast<quint64>(string.capacity() + 1) * sizeof(QChar);
+	};
 };
 
 // SFINAE on members
@@ -81,8 +726,16 @@ protected:
 		std::function<QVariant(N, const Qt::ItemDataRole&)> m_dataCallback;
 		std::function<QList<QMetaObject::Connection>(N, std::function<void()>)> m_changeCallback;
 		std::function<bool(N)> m_editableCallback;
+		QUaModelColumnRoles m_roles;
+		// NOTE : false for gaps between defined columns
+		bool m_isDefined;
+		// subscribe (node, signal) in QUaSignalHub, false if node has no such signal
+		QList<std::function<bool(N, const void*, const std::function<void()>&)>> m_changeSignals;
+		// cache dataCallback results in wrappers
+		bool m_isCached;
 	};
-	QMap<int, ColumnDataSource> m_mapDataSourceFuncs;
+	// NOTE : indexed by column, so lookup is just an offset
+	QVector<ColumnDataSource> m_vectDataSourceFuncs;
 };
 
 // instance specialization
@@ -96,8 +749,14 @@ protected:
 		std::function<QVariant(N*, const Qt::ItemDataRole&)> m_dataCallback;
 		std::function<QList<QMetaObject::Connection>(N*, std::function<void()>)> m_changeCallback;
 		std::function<bool(N*)> m_editableCallback;
+		QUaModelColumnRoles m_roles;
+		// NOTE : false for gaps between defined columns
+		bool m_isDefined;
+		// cache dataCallback results in wrappers
+		bool m_isCached;
 	};
-	QMap<int, ColumnDataSource> m_mapDataSourceFuncs;
+	// NOTE : indexed by column, so lookup is just an offset
+	QVector<ColumnDataSource> m_vectDataSourceFuncs;
 };
 
 template <typename N, int I>
@@ -125,6 +784,15 @@ public:
 	typename std::enable_if<!std::is_pointer<X>::value, X*>::type
 	nodeFromIndex(const QModelIndex& index) const;
 
+	// NOTE : hashed lookup, invalid index if node not in model
+	template<typename X = N>
+	typename std::enable_if<std::is_pointer<X>::value, QModelIndex>::type
+	indexFromNode(N node, const int& column = 0) const;
+
+	template<typename X = N>
+	typename std::enable_if<!std::is_pointer<X>::value, QModelIndex>::type
+	indexFromNode(N* node, const int& column = 0) const;
+
 	template<
 		typename X = N,
 		typename M = const std::function<void(N, const QModelIndex&)>&
@@ -147,6 +815,30 @@ public:
 		Qt::ConnectionType type = Qt::AutoConnection
 	);
 
+	// called each time a cell is marked as changed (before notifications are
+	// coalesced), index is the changed cell
+	template<
+		typename X = N,
+		typename M = const std::function<void(N, const QModelIndex&)>&
+	>
+	typename std::enable_if<std::is_pointer<X>::value, QMetaObject::Connection>::type
+	connectNodeChangedCallback(
+		const QObject* context,
+		M nodeChangedCallback,
+		Qt::ConnectionType type = Qt::AutoConnection
+	);
+
+	template<
+		typename X = N,
+		typename M = const std::function<void(N*, const QModelIndex&)>&
+	>
+	typename std::enable_if<!std::is_pointer<X>::value, QMetaObject::Connection>::type
+	connectNodeChangedCallback(
+		const QObject* context,
+		M nodeChangedCallback,
+		Qt::ConnectionType type = Qt::AutoConnection
+	);
+
 	bool disconnectNodeAddedCallback(const QMetaObject::Connection& connection);
 
 	template<
@@ -161,7 +853,8 @@ public:
 		const QString& strHeader,
 		M1 dataCallback,              
 		M2 changeCallback   = nullptr,
-		M3 editableCallback = nullptr 
+		M3 editableCallback = nullptr,
+		const QVector<int>& roles = QVector<int>()
 	);
 
 	template<
@@ -176,19 +869,89 @@ public:
 		const QString& strHeader,
 		M1 dataCallback,
 		M2 changeCallback   = nullptr,
-		M3 editableCallback = nullptr
+		M3 editableCallback = nullptr,
+		const QVector<int>& roles = QVector<int>()
 	);
 
-    void removeColumnDataSource(const int& column);
+	// notify column changes when signal is emitted by node (if node has such signal)
+	// NOTE : alternative to changeCallback for QObject nodes, a single connection
+	//        per (node, signal) is shared by all wrappers, columns and models
+	template<typename Func, typename X = N>
+	typename std::enable_if<std::is_pointer<X>::value, void>::type
+	addColumnChangeSignal(
+		const int& column,
+		Func signal
+	);
 
-	void clear();
+    // NOTE : if roles are declared in setColumnDataSource, data() only calls 
+    //        dataCallback for those roles and dataChanged only carries those 
+    //        roles, editability only depends on editableCallback
+    void removeColumnDataSource(const int& column);
 
+	// cache results of column's dataCallback per cell and role
+	// NOTE : cell cache is invalidated when column's change callback or 
+	//        change signal fires, else use invalidateCache manually
+	bool isColumnCached(const int& column) const;
+	void setColumnCached(const int& column, const bool& cached = true);
+
+	// invalidate cached data of cell at index (and notify views)
+	void invalidateCache(const QModelIndex& index);
+	// invalidate cached data of all cells in column (and notify views)
+	void invalidateColumnCache(const int& column);
+
+	// NOTE : virtual so derived models also drop their own pending state
+	virtual void clear();
+
+	// debug : re-check all indexes of the affected sub-tree after each 
+	// structural change (also enabled by default if QUA_MODEL_CHECK_INDEXES defined)
+	bool indexChecksEnabled() const;
+	void setIndexChecksEnabled(const bool& enabled);
+
+	// max number of times per second that accumulated data changes are notified
+	// NOTE : changes are always coalesced into rectangular dataChanged ranges,
+	//        0 (default) means no rate limit, flush on next event loop iteration
+	int  maxUpdateRate() const;
+	void setMaxUpdateRate(const int& maxUpdateRate);
+
+	// NOTE : structural tasks (inserts, removes, resets) run first, data tasks
+	//        (notifications) next and idle tasks (index building, sorting, 
+	//        cache warming) only when the event loop has nothing else to do
 	template<typename M1 = const std::function<void(void)>&>
-	inline void execLater(M1 func)
+	inline void execLater(
+		M1 func, 
+		const QUaModelBaseEventer::Priority& priority = QUaModelBaseEventer::Priority::Structural
+	)
 	{
-		this->m_eventer.execLater(func);
+		this->m_eventer.execLater(func, priority);
 	};
 
+	// post mutations from any thread, they are applied in batches in the
+	// model's thread through the coalesced remove and dataChanged paths
+	// NOTE : column -1 means all columns, node must outlive posted mutation
+	template<typename X = N>
+	typename std::enable_if<std::is_pointer<X>::value, void>::type
+	postDataChange(N node, const int& column = -1);
+
+	template<typename X = N>
+	typename std::enable_if<std::is_pointer<X>::value, void>::type
+	postRemoveNode(N node);
+
+	// performance counters, disabled by default
+	// NOTE : cheap (plain counters and a clock read around callbacks), 
+	//        can be left enabled in production
+	bool statsEnabled() const;
+	void setStatsEnabled(const bool& enabled);
+	QUaModelStats stats() const;
+	void resetStats();
+
+	// estimated memory footprint per structure, walks all wrappers
+	QUaModelMemoryReport memoryReport() const;
+
+	// max milliseconds per event loop iteration spent running deferred tasks
+	// NOTE : default is 4ms, 0 means run all pending tasks at once
+	int  schedulerBudget() const;
+	void setSchedulerBudget(const int& budgetMs);
+
     // Qt required API:
     QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
 
@@ -204,6 +967,9 @@ public:
 
     Qt::ItemFlags flags(const QModelIndex& index) const override;
 
+	// NOTE : only removes wrappers from model, nodes are not deleted
+	bool removeRows(int row, int count, const QModelIndex& parent = QModelIndex()) override;
+
 protected:
 
     class QUaNodeWrapper
@@ -216,6 +982,10 @@ protected:
 
         ~QUaNodeWrapper();
 
+        // NOTE : allocated from a slab pool instead of one heap allocation each
+        static void* operator new(std::size_t size);
+        static void  operator delete(void* ptr);
+
 		template<typename X = N>
 		typename std::enable_if<std::is_pointer<X>::value, X>::type
         node() const;
@@ -228,10 +998,14 @@ protected:
         void   setUserData(void* data);
 		/*QUaModel<N, I>::*/QUaNodeWrapper* findChildByData(const void* childData) const;
 
-        QModelIndex index() const;
-        void setIndex(const QModelIndex &index);
+        // NOTE : row in parent's children list is cached, kept up to date 
+        //        by insert and remove operations, so no search is needed
+        int  row() const;
+        void setRow(const int& row);
 
         /*QUaModel<N, I>::*/QUaNodeWrapper* parent() const;
+        // NOTE : only to relink a sub-tree, caller updates children lists
+        void setParent(/*QUaModel<N, I>::*/QUaNodeWrapper* parent);
 
 		template<typename X = N>
 		typename std::enable_if<std::is_pointer<X>::value, /*QUaModel<N, I>::*/QUaNodeWrapper*>::type
@@ -243,43 +1017,265 @@ protected:
 
         // NOTE : return by reference
         QList</*QUaModel<N, I>::*/QUaNodeWrapper*> & children();
+        // create wrappers for all children of node (recursivelly by default)
+        // NOTE : non recursive leaves children not fetched (lazy population)
+        void buildChildren(const bool& recursive = true);
+        // same but for children already retrieved from node
+        void buildChildren(const QList<N>& children, const bool& recursive);
+        // true once children have been built
+        bool isFetched() const;
+        // answer of QUaTreeModel::hasChildren while not fetched, so node is
+        // not asked for its children on every call
+        bool isHasChildrenCached() const;
+        bool cachedHasChildren() const;
+        void setCachedHasChildren(const bool& hasChildren);
         QList<QMetaObject::Connection> & connections();
-
-        std::function<void()> getChangeCallbackForColumn(const int& column, QAbstractItemModel* model);
+        // wrapper unsubscribes from QUaSignalHub on destruction
+        void setHubSubscribed();
+        bool isHubSubscribed() const;
+        // disconnect from node and invalidate it, used when node is being
+        // destroyed (see QUaModel::detachWrapper)
+        void detachNode();
+
+        // per cell data cache, returns nullptr if not cached
+        const QVariant* cachedData(const int& column, const int& role) const;
+        void setCachedData(const int& column, const int& role, const QVariant& value);
+        void invalidateCachedData(const int& column);
+        int cachedDataCount() const;
+        quint64 cachedDataBytes() const;
+
+        // hash of node when added to model's node index
+        uint hash() const;
+        void setHash(const uint& hash);
+
+        std::function<void()> getChangeCallbackForColumn(const int& column, QUaModel<N, I>* model);
 
     private:
+        // NOTE : pointer sized members first (N, pointers and Qt 5 implicitly 
+        //        shared containers), then 4 byte ones, then flags, so only 
+        //        the tail is padded when N is a pointer, measure with
+        //        QUaModelMemoryReport::wrapperSize (see wrapperMemory benchmark)
+        //        no QModelIndex stored, model creates it from row on demand
+        //        (see QUaModel::indexFromWrapper)
         // internal data
         N m_node;
 		void * m_userData;
-        // NOTE : need index to support model manipulation 
-        //        cannot use createIndex outside Qt's API
-        //        (doesnt work even inside a QAbstractItemModel member)
-        //        and for beginRemoveRows and beginInsertRows
-        //        we can only use the indexes provided by the model
-        //        else random crashes occur when manipulating model
-        //        btw do not use QPersistentModelIndex, they get corrupted
-        QModelIndex m_index;
         // members for tree structure
         QUaNodeWrapper* m_parent;
+        // NOTE : one pointer array per parent, children are not contiguous
         QList<QUaNodeWrapper*> m_children;
         QList<QMetaObject::Connection> m_connections;
+        // NOTE : only cached columns are stored, empty costs no allocation
+        struct CachedData
+        {
+            int m_column;
+            int m_role;
+            QVariant m_value;
+        };
+        QVector<CachedData> m_cache;
+        int m_row;
+        // NOTE : stored because node is invalid by the time it is removed
+        uint m_hash;
+        // NOTE : fits in padding after m_hash
+        bool m_hubSubscribed;
+        bool m_fetched;
+        bool m_hasChildrenCached;
+        bool m_hasChildren;
     };
 
+    typedef QUaModelSlabPool<sizeof(QUaNodeWrapper), alignof(QUaNodeWrapper)> QUaNodeWrapperPool;
+
     QUaNodeWrapper* m_root;
 	QUaModelBaseEventer m_eventer;
 	int m_columnCount;
+	bool m_checkIndexes;
+	// data change coalescing
+	int m_maxUpdateRate;
+	QTimer m_timerUpdates;
+	QElapsedTimer m_timeLastUpdate;
+	QSet<QPair<QUaNodeWrapper*, int>> m_setDirtyCells;
+	// node index, QUaModelItemTraits::Hash to wrappers
+	// NOTE : multi because same node can be in more than one place
+	QMultiHash<uint, QUaNodeWrapper*> m_hashNodes;
+	// performance counters
+	bool m_statsEnabled;
+	mutable QUaModelStats m_stats;
+	QList<QMetaObject::Connection> m_statsConnections;
+	// trace hooks on own notifications, only while QUaModelTracer enabled
+	QList<QMetaObject::Connection> m_traceConnections;
+	void setTraceConnected(const bool& connected);
+	// mutations posted from other threads
+	enum class MutationType
+	{
+		Insert,
+		Remove,
+		DataChange
+	};
+	struct Mutation
+	{
+		MutationType m_type;
+		N m_node;
+		int m_column;
+	};
+	QUaModelMpscQueue<Mutation> m_queueMutations;
+	std::atomic<bool> m_mutationsScheduled;
+
+	// add model specific structures to memory report
+	virtual void addToMemoryReport(QUaModelMemoryReport& report) const;
+
+	// counters to pass to QUaModelStatsTimer, nullptr if stats disabled
+	quint64* statsCallbackCalls() const;
+	quint64* statsCallbackNsecs() const;
+	quint64* statsTraitCalls() const;
+	quint64* statsTraitNsecs() const;
+	void countDataCall(const int& column, const int& role) const;
+	// IsValid trait call on wrapper's node, timed as trait call
+	bool isWrapperValid(QUaNodeWrapper* wrapper) const;
+	// true if wrapper is in node index under hash, wrapper is not accessed
+	// NOTE : hash is QUaNodeWrapper::hash, taken while wrapper was alive
+	bool isWrapperIndexed(QUaNodeWrapper* wrapper, const uint& hash) const;
+
+	// thread safe, wakes up model's thread once per batch
+	void postMutation(const Mutation& mutation);
+
+	// apply posted mutations in order, consecutive mutations of same type 
+	// are applied at once, stops when scheduler budget is consumed
+	void processPostedMutations();
+
+	// apply a run of posted mutations of the same type
+	// NOTE : inserts are model specific, table models add rows at the end
+	virtual void applyPostedInserts(const QList<N>& nodes);
+	// publish rows buffered by derived model before posted removals, so 
+	// no removed wrapper is still referenced by them
+	virtual void flushPendingInserts();
 
-    void bindChangeCallbackForColumn(
-        const int& column,
-        QUaNodeWrapper* wrapper,
-        const bool& recursive = true);
+	template<typename X = N>
+	typename std::enable_if<std::is_pointer<X>::value, void>::type
+	applyPostedMutations(const MutationType& type, const QList<Mutation>& mutations);
+
+	template<typename X = N>
+	typename std::enable_if<!std::is_pointer<X>::value, void>::type
+	applyPostedMutations(const MutationType& type, const QList<Mutation>& mutations);
+
+    void bindChangeCallbackForColumn(
+        const int& column,
+        QUaNodeWrapper* wrapper,
+        const bool& recursive = true);
 
     void bindChangeCallbackForAllColumns(
         QUaNodeWrapper* wrapper,
         const bool& recursive = true);
 
+	// true if column has change signals (see addColumnChangeSignal)
+	template<typename X = N>
+	typename std::enable_if<std::is_pointer<X>::value, bool>::type
+	hasColumnChangeSignals(const int& column) const;
+	template<typename X = N>
+	typename std::enable_if<!std::is_pointer<X>::value, bool>::type
+	hasColumnChangeSignals(const int& column) const;
+	// subscribe wrapper's node to column's change signals in QUaSignalHub
+	template<typename X = N>
+	typename std::enable_if<std::is_pointer<X>::value, void>::type
+	bindChangeSignalsForColumn(const int& column, QUaNodeWrapper* wrapper);
+	template<typename X = N>
+	typename std::enable_if<!std::is_pointer<X>::value, void>::type
+	bindChangeSignalsForColumn(const int& column, QUaNodeWrapper* wrapper);
+	// drop QUaSignalHub subscriptions of all wrappers for column
+	void unbindChangeSignalsForColumn(const int& column);
+
 	void removeWrapper(typename QUaModel<N, I>::QUaNodeWrapper* wrapper);
 
+	// drop connections and nodes of wrapper's sub-tree, so destroyed signals 
+	// of descendants are ignored and no wrapper points to a deleted node
+	void detachWrapper(typename QUaModel<N, I>::QUaNodeWrapper* wrapper);
+
+	// remove many wrappers at once, rows are grouped by parent and collapsed 
+	// into contiguous ranges, so views are notified once per range
+	// NOTE : wrappers whose ancestor is also in the list are ignored
+	void removeWrappers(const QList<QUaNodeWrapper*>& wrappers);
+
+	// add wrapper (and sub-tree if recursive) to node index, root is ignored
+	void indexNodes(
+		QUaNodeWrapper* wrapper,
+		const bool& recursive = true
+	);
+
+	// remove wrapper (and sub-tree if recursive) from node index (all if nullptr)
+	// NOTE : must be called before deleting wrappers
+	void unindexNodes(
+		QUaNodeWrapper* wrapper = nullptr,
+		const bool& recursive = true
+	);
+
+	// all wrappers of node using node index
+	template<typename X = N>
+	typename std::enable_if<std::is_pointer<X>::value, QList<QUaNodeWrapper*>>::type
+	wrappersFromNode(N node) const;
+
+	template<typename X = N>
+	typename std::enable_if<!std::is_pointer<X>::value, QList<QUaNodeWrapper*>>::type
+	wrappersFromNode(N* node) const;
+
+	// index of wrapper in column 0, invalid if root
+	QModelIndex indexFromWrapper(
+		QUaNodeWrapper* wrapper
+	) const;
+
+	// call column's dataCallback or return cached value
+	QVariant columnData(
+		const typename QUaModelBase<N, I>::ColumnDataSource* source,
+		QUaNodeWrapper* wrapper,
+		const int& column,
+		const int& role
+	) const;
+
+	// clear cached data of all cells in column, no notification
+	void clearColumnCache(const int& column);
+
+	// nullptr if no ColumnDataSource defined for column
+	const typename QUaModelBase<N, I>::ColumnDataSource* columnDataSource(
+		const int& column
+	) const;
+
+	// mark cell as changed, dataChanged is emitted later by processPendingUpdates
+	void markDirty(
+		QUaNodeWrapper* wrapper, 
+		const int& column
+	);
+
+	// emit dataChanged for all dirty cells, merged into rectangles per parent
+	void processPendingUpdates();
+
+	// union of roles declared by columns in range
+	// NOTE : empty (all roles) if any column did not declare roles
+	QVector<int> columnRoles(
+		const int& firstColumn,
+		const int& lastColumn
+	) const;
+
+	// forget dirty cells of wrapper's sub-tree (all if nullptr)
+	// NOTE : must be called before deleting wrappers
+	void discardPendingUpdates(
+		QUaNodeWrapper* wrapper = nullptr
+	);
+
+	// update stored rows of parent's children starting at row first
+	// NOTE : only rows after an insert or remove need to be shifted
+	void reindexChildren(
+		QUaNodeWrapper* parent,
+		const int& first = 0
+	) const;
+
+	void reindexChildrenRecursive(
+		QUaNodeWrapper* parent
+	) const;
+
+	// runs checkIndexRecursive only if index checks enabled
+	void debugCheckIndex(
+		const QModelIndex& index,
+		const bool& isRoot = false
+	) const;
+
 #if QT_VERSION < QT_VERSION_CHECK(5, 11, 0)
 	bool checkIndex(
 		const QModelIndex& index
@@ -305,11 +1301,39 @@ inline QUaModel<N, I>::QUaModel(QObject* parent) :
 {
 	m_root = nullptr;
 	m_columnCount = 1;
+#ifdef QUA_MODEL_CHECK_INDEXES
+	m_checkIndexes = true;
+#else
+	m_checkIndexes = false;
+#endif // QUA_MODEL_CHECK_INDEXES
+	m_maxUpdateRate = 0;
+	m_timerUpdates.setSingleShot(true);
+	QObject::connect(&m_timerUpdates, &QTimer::timeout, this,
+	[this]() {
+		this->processPendingUpdates();
+	});
+	// NOTE : structural counters are connected in setStatsEnabled and
+	//        trace events in setTraceConnected, only while enabled
+	m_statsEnabled = false;
+	this->setTraceConnected(QUaModelTracer::isEnabled());
+	QUaModelTracer::instance()->addEnabledCallback(this,
+	[this](const bool& enabled) {
+		this->setTraceConnected(enabled);
+	});
+	m_mutationsScheduled.store(false);
+	// NOTE : queued because signal is emitted from producer threads
+	QObject::connect(&m_eventer, &QUaModelBaseEventer::mutationsPosted, this,
+	[this]() {
+		this->processPostedMutations();
+	}, Qt::QueuedConnection);
 }
 
 template<class N, int I>
 inline QUaModel<N, I>::~QUaModel()
 {
+	QUaModelTracer::instance()->removeEnabledCallback(this);
+	m_timerUpdates.stop();
+	m_setDirtyCells.clear();
 	if (m_root)
 	{
 		delete m_root;
@@ -317,6 +1341,48 @@ inline QUaModel<N, I>::~QUaModel()
 	}
 }
 
+template<class N, int I>
+inline void QUaModel<N, I>::setTraceConnected(const bool& connected)
+{
+	while (m_traceConnections.count() > 0)
+	{
+		QObject::disconnect(m_traceConnections.takeFirst());
+	}
+	if (!connected)
+	{
+		return;
+	}
+	// NOTE : trace events from own notifications, covers all paths
+	m_traceConnections << QObject::connect(this, &QAbstractItemModel::rowsAboutToBeInserted, this,
+	[]() {
+		QUaModelTracer::instance()->begin("insertRows", "model");
+	});
+	m_traceConnections << QObject::connect(this, &QAbstractItemModel::rowsInserted, this,
+	[]() {
+		QUaModelTracer::instance()->end("insertRows", "model");
+	});
+	m_traceConnections << QObject::connect(this, &QAbstractItemModel::rowsAboutToBeRemoved, this,
+	[]() {
+		QUaModelTracer::instance()->begin("removeRows", "model");
+	});
+	m_traceConnections << QObject::connect(this, &QAbstractItemModel::rowsRemoved, this,
+	[]() {
+		QUaModelTracer::instance()->end("removeRows", "model");
+	});
+	m_traceConnections << QObject::connect(this, &QAbstractItemModel::modelAboutToBeReset, this,
+	[]() {
+		QUaModelTracer::instance()->begin("resetModel", "model");
+	});
+	m_traceConnections << QObject::connect(this, &QAbstractItemModel::modelReset, this,
+	[]() {
+		QUaModelTracer::instance()->end("resetModel", "model");
+	});
+	m_traceConnections << QObject::connect(this, &QAbstractItemModel::dataChanged, this,
+	[]() {
+		QUaModelTracer::instance()->instant("dataChanged", "model");
+	});
+}
+
 template<typename N, int I>
 inline bool QUaModel<N, I>::disconnectNodeAddedCallback(const QMetaObject::Connection& /*connection*/)
 {
@@ -327,324 +1393,1346 @@ template<class N, int I>
 inline void QUaModel<N, I>::removeColumnDataSource(const int& column)
 {
 	Q_ASSERT(column >= 0);
-    if (column < 0 || column >= m_columnCount || !QUaModelBase<N, I>::m_mapDataSourceFuncs.contains(column))
+	if (column < 0 || column >= m_columnCount || !this->columnDataSource(column))
 	{
 		return;
 	}
-    QUaModelBase<N, I>::m_mapDataSourceFuncs.remove(column);
-    while (!QUaModelBase<N, I>::m_mapDataSourceFuncs.contains(m_columnCount - 1) && m_columnCount > 1)
+	auto& vectDataSourceFuncs = QUaModelBase<N, I>::m_vectDataSourceFuncs;
+	if (vectDataSourceFuncs.at(column).m_isCached)
+	{
+		this->clearColumnCache(column);
+	}
+	// removed change signals must not dispatch anymore
+	this->unbindChangeSignalsForColumn(column);
+	vectDataSourceFuncs[column] = typename QUaModelBase<N, I>::ColumnDataSource();
+	// drop trailing gaps
+	while (!vectDataSourceFuncs.isEmpty() && !vectDataSourceFuncs.last().m_isDefined)
 	{
-		m_columnCount--;
+		vectDataSourceFuncs.removeLast();
 	}
+	m_columnCount = (std::max)(1, vectDataSourceFuncs.count());
 }
 
 template<typename N, int I>
-inline void QUaModel<N, I>::clear()
+inline bool QUaModel<N, I>::isColumnCached(const int& column) const
 {
-	this->beginResetModel();
-	while (m_root->children().count() > 0)
+	auto source = this->columnDataSource(column);
+	return source && source->m_isCached;
+}
+
+template<typename N, int I>
+inline void QUaModel<N, I>::setColumnCached(const int& column, const bool& cached/* = true*/)
+{
+	Q_ASSERT_X(this->columnDataSource(column),
+		"QUaModel::setColumnCached",
+		"Call setColumnDataSource first.");
+	if (!this->columnDataSource(column) || this->isColumnCached(column) == cached)
 	{
-		auto wrapper = m_root->children().takeFirst();
-		// NOTE : QUaNodeWrapper destructor removes connections
-		delete wrapper;
+		return;
+	}
+	QUaModelBase<N, I>::m_vectDataSourceFuncs[column].m_isCached = cached;
+	if (!cached)
+	{
+		this->clearColumnCache(column);
 	}
-	this->endResetModel();
 }
 
-template<class N, int I>
-inline QVariant QUaModel<N, I>::headerData(int section, Qt::Orientation orientation, int role) const
+template<typename N, int I>
+inline void QUaModel<N, I>::invalidateCache(const QModelIndex& index)
 {
-	// no header data if invalid root
-	if (!m_root)
+	if (!m_root || !index.isValid())
 	{
-		return QVariant();
+		return;
 	}
-	// handle only horizontal header text
-	if (orientation != Qt::Horizontal || role != Qt::DisplayRole)
+	auto wrapper = static_cast<QUaNodeWrapper*>(index.internalPointer());
+	Q_CHECK_PTR(wrapper);
+	// NOTE : markDirty invalidates cache
+	this->markDirty(wrapper, index.column());
+}
+
+template<typename N, int I>
+inline void QUaModel<N, I>::invalidateColumnCache(const int& column)
+{
+	if (!m_root || !this->columnDataSource(column))
 	{
-		return QVariant();
+		return;
 	}
-	// default implementation if no ColumnDataSource has been defined
-    if (QUaModelBase<N, I>::m_mapDataSourceFuncs.isEmpty())
+	QList<QUaNodeWrapper*> wrappers = m_root->children();
+	for (int i = 0; i < wrappers.count(); i++)
 	{
-		Q_ASSERT(m_columnCount == 1);
-		return tr("");
+		auto wrapper = wrappers.at(i);
+		wrappers << wrapper->children();
+		// NOTE : markDirty invalidates cache
+		this->markDirty(wrapper, column);
 	}
-	// empty if no ColumnDataSource defined for this column
-    if (!QUaModelBase<N, I>::m_mapDataSourceFuncs.contains(section))
+}
+
+template<typename N, int I>
+inline void QUaModel<N, I>::clear()
+{
+	this->beginResetModel();
+	// NOTE : views re-read everything after reset
+	this->discardPendingUpdates();
+	this->unindexNodes();
+	while (m_root->children().count() > 0)
 	{
-		return QVariant();
+		auto wrapper = m_root->children().takeFirst();
+		// NOTE : QUaNodeWrapper destructor removes connections
+		delete wrapper;
 	}
-	// use user-defined ColumnDataSource
-    return QUaModelBase<N, I>::m_mapDataSourceFuncs[section].m_strHeader;
+	this->endResetModel();
+}
+
+template<typename N, int I>
+inline bool QUaModel<N, I>::indexChecksEnabled() const
+{
+	return m_checkIndexes;
+}
+
+template<typename N, int I>
+inline void QUaModel<N, I>::setIndexChecksEnabled(const bool& enabled)
+{
+	m_checkIndexes = enabled;
+}
+
+template<typename N, int I>
+inline int QUaModel<N, I>::maxUpdateRate() const
+{
+	return m_maxUpdateRate;
+}
+
+template<typename N, int I>
+inline void QUaModel<N, I>::setMaxUpdateRate(const int& maxUpdateRate)
+{
+	Q_ASSERT(maxUpdateRate >= 0);
+	m_maxUpdateRate = qMax(0, maxUpdateRate);
 }
 
 template<class N, int I>
-inline QModelIndex QUaModel<N, I>::index(int row, int column, const QModelIndex& parent) const
+template<typename X>
+inline typename std::enable_if<std::is_pointer<X>::value, void>::type
+QUaModel<N, I>::postDataChange(N node, const int& column/* = -1*/)
 {
-	if (!m_root || !this->hasIndex(row, column, parent))
-	{
-		return QModelIndex();
-	}
-	QUaNodeWrapper* parentWrapper;
-	// invalid parent index is root, else get internal reference
-	if (!parent.isValid())
+	Mutation mutation;
+	mutation.m_type   = MutationType::DataChange;
+	mutation.m_node   = node;
+	mutation.m_column = column;
+	this->postMutation(mutation);
+}
+
+template<class N, int I>
+template<typename X>
+inline typename std::enable_if<std::is_pointer<X>::value, void>::type
+QUaModel<N, I>::postRemoveNode(N node)
+{
+	Mutation mutation;
+	mutation.m_type   = MutationType::Remove;
+	mutation.m_node   = node;
+	mutation.m_column = -1;
+	this->postMutation(mutation);
+}
+
+template<class N, int I>
+inline void QUaModel<N, I>::postMutation(const Mutation& mutation)
+{
+	m_queueMutations.push(mutation);
+	// only first producer after a drain wakes up the model's thread
+	if (m_mutationsScheduled.exchange(true))
 	{
-		parentWrapper = m_root;
+		return;
 	}
-	else
+	Q_EMIT m_eventer.mutationsPosted();
+}
+
+template<class N, int I>
+inline void QUaModel<N, I>::processPostedMutations()
+{
+	// NOTE : reset before draining, so mutations posted meanwhile wake us up again
+	m_mutationsScheduled.store(false);
+	QElapsedTimer timer;
+	timer.start();
+	const int budget = m_eventer.budget();
+	QList<Mutation> run;
+	Mutation mutation;
+	while (m_queueMutations.pop(mutation))
 	{
-		parentWrapper = static_cast<QUaNodeWrapper*>(parent.internalPointer());
+		if (!run.isEmpty() && run.last().m_type != mutation.m_type)
+		{
+			this->applyPostedMutations(run.last().m_type, run);
+			run.clear();
+		}
+		run << mutation;
+		if (budget > 0 && timer.elapsed() >= budget)
+		{
+			break;
+		}
 	}
-	Q_CHECK_PTR(parentWrapper);
-	// browse n-th child wrapper node
-	auto childWrapper = parentWrapper->children().count() > row ?
-		parentWrapper->children().at(row) : nullptr;
-	if (!childWrapper)
+	if (!run.isEmpty())
 	{
-		return QModelIndex();
+		this->applyPostedMutations(run.last().m_type, run);
 	}
-	// create index
-	QModelIndex index = this->createIndex(row, column, childWrapper);
-	// store index to support model manipulation
-	if (column == 0)
+	// continue in next event loop iteration
+	if (m_queueMutations.isEmpty() || m_mutationsScheduled.exchange(true))
 	{
-		childWrapper->setIndex(index);
+		return;
 	}
-	return index;
+	Q_EMIT m_eventer.mutationsPosted();
 }
 
 template<class N, int I>
-inline QModelIndex QUaModel<N, I>::parent(const QModelIndex& index) const
+inline void QUaModel<N, I>::applyPostedInserts(const QList<N>& nodes)
 {
-	if (!m_root || !index.isValid())
-    {
-        return QModelIndex();
-    }
-    auto intId = index.internalId();
-    Q_UNUSED(intId);
-    // get child and parent node references
-    auto childWrapper  = static_cast<QUaNodeWrapper*>(index.internalPointer());
-    Q_CHECK_PTR(childWrapper);
-    auto parentWrapper = static_cast<QUaNodeWrapper*>(childWrapper->parent());
-    Q_CHECK_PTR(parentWrapper);
-    if (parentWrapper == m_root)
-    {
-        // store index to support model manipulation
-        QModelIndex pIndex = QModelIndex();
-        parentWrapper->setIndex(pIndex);
-        return pIndex;
-    }
-    // get row of parent if grandparent is valid
-    int row = 0;
-    auto grandpaWrapper = static_cast<QUaNodeWrapper*>(parentWrapper->parent());
-    if (grandpaWrapper)
-    {
-        row = grandpaWrapper->children().indexOf(parentWrapper);
-    }
-    // store index to support model manipulation
-    QModelIndex pIndex = this->createIndex(row, 0, parentWrapper);
-	parentWrapper->setIndex(pIndex);
-    return pIndex;
+	// NOTE : not supported by default, tree models follow node's structure
+	Q_ASSERT_X(nodes.isEmpty(), "QUaModel::applyPostedInserts", "Model does not support posted inserts.");
+	Q_UNUSED(nodes);
 }
 
 template<class N, int I>
-inline int QUaModel<N, I>::rowCount(const QModelIndex& parent) const
+inline void QUaModel<N, I>::flushPendingInserts()
 {
-	if (!m_root || parent.column() > 0)
-	{
-		return 0;
-	}
-	QUaNodeWrapper* parentWrapper;
-	// get internal wrapper reference
-	if (!parent.isValid())
-	{
-		parentWrapper = m_root;
-	}
-	else
-	{
-		parentWrapper = static_cast<QUaNodeWrapper*>(parent.internalPointer());
-	}
-	// return number of children
-	Q_CHECK_PTR(parentWrapper);
-	int childCount = parentWrapper->children().count();
-	return childCount;
+	// NOTE : nothing buffered by default
 }
 
 template<class N, int I>
-inline int QUaModel<N, I>::columnCount(const QModelIndex& parent) const
+template<typename X>
+inline typename std::enable_if<std::is_pointer<X>::value, void>::type
+QUaModel<N, I>::applyPostedMutations(const MutationType& type, const QList<Mutation>& mutations)
 {
-	Q_UNUSED(parent);
-	if (!m_root)
+	switch (type)
 	{
-		return 0;
+	case MutationType::Insert:
+		{
+			QList<N> nodes;
+			for (auto& mutation : mutations)
+			{
+				nodes << mutation.m_node;
+			}
+			this->applyPostedInserts(nodes);
+		}
+		break;
+	case MutationType::Remove:
+		{
+			// NOTE : before lookup, so buffered wrappers are also found
+			this->flushPendingInserts();
+			// NOTE : one beginRemoveRows per contiguous range
+			QList<QUaNodeWrapper*> wrappers;
+			for (auto& mutation : mutations)
+			{
+				wrappers << this->wrappersFromNode(mutation.m_node);
+			}
+			this->removeWrappers(wrappers);
+		}
+		break;
+	case MutationType::DataChange:
+		{
+			// NOTE : coalesced into rectangles by processPendingUpdates
+			for (auto& mutation : mutations)
+			{
+				auto wrappers = this->wrappersFromNode(mutation.m_node);
+				for (auto wrapper : wrappers)
+				{
+					if (mutation.m_column >= 0)
+					{
+						this->markDirty(wrapper, mutation.m_column);
+						continue;
+					}
+					for (int column = 0; column < m_columnCount; column++)
+					{
+						this->markDirty(wrapper, column);
+					}
+				}
+			}
+		}
+		break;
 	}
-	// minimum 1 column
-	return m_columnCount;
 }
 
 template<class N, int I>
-inline QVariant QUaModel<N, I>::data(const QModelIndex& index, int role) const
+template<typename X>
+inline typename std::enable_if<!std::is_pointer<X>::value, void>::type
+QUaModel<N, I>::applyPostedMutations(const MutationType& type, const QList<Mutation>& mutations)
 {
-	// early exit for inhandled cases
-	if (!m_root || !index.isValid())
-	{
-		return QVariant();
-	}
-	// get internal reference
-	auto wrapper = static_cast<QUaNodeWrapper*>(index.internalPointer());
-	// check internal wrapper data is valid, because wrapper->node() is always deleted before wrapper
-	if(!QUaModelItemTraits::IsValid<N, I>(wrapper->node()))
+	// NOTE : value nodes are owned by model, only inserts can be posted
+	Q_ASSERT(type == MutationType::Insert);
+	if (type != MutationType::Insert)
 	{
-		return QVariant();
-	}
-	// default implementation if no ColumnDataSource has been defined
-    if (QUaModelBase<N, I>::m_mapDataSourceFuncs.isEmpty())
-	{
-		Q_ASSERT(m_columnCount == 1);
-		return tr("");
+		return;
 	}
-	// empty if no ColumnDataSource defined for this column
-    if (!QUaModelBase<N, I>::m_mapDataSourceFuncs.contains(index.column()) ||
-        !QUaModelBase<N, I>::m_mapDataSourceFuncs[index.column()].m_dataCallback)
+	QList<N> nodes;
+	for (auto& mutation : mutations)
 	{
-		return QVariant();
+		nodes << mutation.m_node;
 	}
-	// use user-defined ColumnDataSource
-    return QUaModelBase<N, I>::m_mapDataSourceFuncs[index.column()].m_dataCallback(
-		wrapper->node(),
-		static_cast<Qt::ItemDataRole>(role)
-	);
+	this->applyPostedInserts(nodes);
 }
 
 template<class N, int I>
-inline bool QUaModel<N, I>::setData(const QModelIndex& index, const QVariant& value, int role)
+inline bool QUaModel<N, I>::statsEnabled() const
 {
-	bool ok = QUaModelItemTraits::SetData<N, I>(this->nodeFromIndex(index), index.column(), value);
-	if (ok)
-	{
-		Q_EMIT this->dataChanged(index, index, QVector<int>() << role);
-	}
-	return ok;
+	return m_statsEnabled;
 }
 
 template<class N, int I>
-inline Qt::ItemFlags QUaModel<N, I>::flags(const QModelIndex& index) const
+inline void QUaModel<N, I>::setStatsEnabled(const bool& enabled)
 {
-	if (!m_root || !index.isValid())
+	if (m_statsEnabled == enabled)
 	{
-		return Qt::NoItemFlags;
+		return;
 	}
-	Qt::ItemFlags flags = QAbstractItemModel::flags(index);
+	m_statsEnabled = enabled;
+	// NOTE : structural counters from own notifications, only connected 
+	//        while enabled so disabled stats cost no slot calls
+	if (!m_statsEnabled)
+	{
+		while (m_statsConnections.count() > 0)
+		{
+			QObject::disconnect(m_statsConnections.takeFirst());
+		}
+		return;
+	}
+	m_statsConnections << QObject::connect(this, &QAbstractItemModel::rowsInserted, this,
+	[this](const QModelIndex&, int first, int last) {
+		m_stats.insertNotifications++;
+		m_stats.rowsInserted += static_cast<quint64>(last - first + 1);
+	});
+	m_statsConnections << QObject::connect(this, &QAbstractItemModel::rowsRemoved, this,
+	[this](const QModelIndex&, int first, int last) {
+		m_stats.removeNotifications++;
+		m_stats.rowsRemoved += static_cast<quint64>(last - first + 1);
+	});
+	m_statsConnections << QObject::connect(this, &QAbstractItemModel::modelReset, this,
+	[this]() {
+		m_stats.resets++;
+	});
+	m_statsConnections << QObject::connect(this, &QAbstractItemModel::dataChanged, this,
+	[this]() {
+		m_stats.dataChangedNotifications++;
+	});
+}
+
+template<class N, int I>
+inline QUaModelStats QUaModel<N, I>::stats() const
+{
+	QUaModelStats stats = m_stats;
+	stats.wrappers        = 0;
+	stats.liveConnections = 0;
+	stats.hubConnections  = QUaSignalHub::instance()->connectionCount();
+	if (!m_root)
+	{
+		return stats;
+	}
+	QList<QUaNodeWrapper*> wrappers;
+	wrappers << m_root;
+	for (int i = 0; i < wrappers.count(); i++)
+	{
+		auto wrapper = wrappers.at(i);
+		wrappers << wrapper->children();
+		stats.liveConnections += wrapper->connections().count();
+	}
+	// NOTE : root is not a row
+	stats.wrappers = wrappers.count() - 1;
+	return stats;
+}
+
+template<class N, int I>
+inline QUaModelMemoryReport QUaModel<N, I>::memoryReport() const
+{
+	QUaModelMemoryReport report;
+	if (m_root)
+	{
+		quint64 childrenBytes    = 0;
+		quint64 connectionsBytes = 0;
+		quint64 cacheBytes       = 0;
+		QList<QUaNodeWrapper*> wrappers;
+		wrappers << m_root;
+		for (int i = 0; i < wrappers.count(); i++)
+		{
+			auto wrapper = wrappers.at(i);
+			wrappers << wrapper->children();
+			childrenBytes    += QUaModelMemoryReport::listBytes(wrapper->children());
+			connectionsBytes += QUaModelMemoryReport::listBytes(wrapper->connections()) +
+				wrapper->connections().count() * QUaModelMemoryReport::ConnectionBytes;
+			cacheBytes       += wrapper->cachedDataBytes();
+			report.connections  += wrapper->connections().count();
+			report.cachedValues += wrapper->cachedDataCount();
+		}
+		report.wrappers = wrappers.count();
+		// NOTE : wrappers are pool allocated, fixed size blocks
+		report.bytes["wrappers"   ] = static_cast<quint64>(wrappers.count()) * QUaNodeWrapperPool::blockSize();
+		report.bytes["children"   ] = childrenBytes;
+		report.bytes["connections"] = connectionsBytes;
+		report.bytes["cache"      ] = cacheBytes;
+	}
+	report.bytes["nodeIndex"     ] = QUaModelMemoryReport::hashBytes(m_hashNodes);
+	report.bytes["pendingUpdates"] = QUaModelMemoryReport::setBytes(m_setDirtyCells);
+	report.wrapperSize       = sizeof(QUaNodeWrapper);
+	report.wrapperBlockSize  = QUaNodeWrapperPool::blockSize();
+	report.poolUsedBlocks    = QUaNodeWrapperPool::usedBlocks();
+	report.poolReservedBytes = QUaNodeWrapperPool::reservedBytes();
+	this->addToMemoryReport(report);
+	return report;
+}
+
+template<class N, int I>
+inline void QUaModel<N, I>::addToMemoryReport(QUaModelMemoryReport& report) const
+{
+	Q_UNUSED(report);
+}
+
+template<class N, int I>
+inline void QUaModel<N, I>::resetStats()
+{
+	m_stats = QUaModelStats();
+}
+
+template<class N, int I>
+inline quint64* QUaModel<N, I>::statsCallbackCalls() const
+{
+	return m_statsEnabled ? &m_stats.callbackCalls : nullptr;
+}
+
+template<class N, int I>
+inline quint64* QUaModel<N, I>::statsCallbackNsecs() const
+{
+	return m_statsEnabled ? &m_stats.callbackNsecs : nullptr;
+}
+
+template<class N, int I>
+inline quint64* QUaModel<N, I>::statsTraitCalls() const
+{
+	return m_statsEnabled ? &m_stats.traitCalls : nullptr;
+}
+
+template<class N, int I>
+inline quint64* QUaModel<N, I>::statsTraitNsecs() const
+{
+	return m_statsEnabled ? &m_stats.traitNsecs : nullptr;
+}
+
+template<class N, int I>
+inline bool QUaModel<N, I>::isWrapperValid(QUaNodeWrapper* wrapper) const
+{
+	QUaModelStatsTimer timer(this->statsTraitCalls(), this->statsTraitNsecs(), "IsValid");
+	return QUaModelItemTraits::IsValid<N, I>(wrapper->node());
+}
+
+template<class N, int I>
+inline bool QUaModel<N, I>::isWrapperIndexed(QUaNodeWrapper* wrapper, const uint& hash) const
+{
+	return m_hashNodes.contains(hash, wrapper);
+}
+
+template<class N, int I>
+inline void QUaModel<N, I>::countDataCall(const int& column, const int& role) const
+{
+	if (!m_statsEnabled)
+	{
+		return;
+	}
+	m_stats.dataCalls++;
+	m_stats.dataCallsByColumnRole[qMakePair(column, role)]++;
+}
+
+template<class N, int I>
+inline int QUaModel<N, I>::schedulerBudget() const
+{
+	return m_eventer.budget();
+}
+
+template<class N, int I>
+inline void QUaModel<N, I>::setSchedulerBudget(const int& budgetMs)
+{
+	Q_ASSERT(budgetMs >= 0);
+	m_eventer.setBudget(budgetMs);
+}
+
+template<class N, int I>
+inline QVariant QUaModel<N, I>::headerData(int section, Qt::Orientation orientation, int role) const
+{
+	// no header data if invalid root
+	if (!m_root)
+	{
+		return QVariant();
+	}
+	// handle only horizontal header text
+	if (orientation != Qt::Horizontal || role != Qt::DisplayRole)
+	{
+		return QVariant();
+	}
+	// default implementation if no ColumnDataSource has been defined
+	if (QUaModelBase<N, I>::m_vectDataSourceFuncs.isEmpty())
+	{
+		Q_ASSERT(m_columnCount == 1);
+		return tr("");
+	}
+	// empty if no ColumnDataSource defined for this column
+	auto source = this->columnDataSource(section);
+	if (!source)
+	{
+		return QVariant();
+	}
+	// use user-defined ColumnDataSource
+	return source->m_strHeader;
+}
+
+template<class N, int I>
+inline QModelIndex QUaModel<N, I>::index(int row, int column, const QModelIndex& parent) const
+{
+	if (m_statsEnabled)
+	{
+		m_stats.indexCalls++;
+	}
+	if (!m_root || !this->hasIndex(row, column, parent))
+	{
+		return QModelIndex();
+	}
+	QUaNodeWrapper* parentWrapper;
+	// invalid parent index is root, else get internal reference
+	if (!parent.isValid())
+	{
+		parentWrapper = m_root;
+	}
+	else
+	{
+		parentWrapper = static_cast<QUaNodeWrapper*>(parent.internalPointer());
+	}
+	Q_CHECK_PTR(parentWrapper);
+	// browse n-th child wrapper node
+	auto childWrapper = parentWrapper->children().count() > row ?
+		parentWrapper->children().at(row) : nullptr;
+	if (!childWrapper)
+	{
+		return QModelIndex();
+	}
+	// create index
+	// NOTE : stored row is updated on insert and remove, not here
+	Q_ASSERT(childWrapper->row() == row);
+	return this->createIndex(row, column, childWrapper);
+}
+
+template<class N, int I>
+inline QModelIndex QUaModel<N, I>::parent(const QModelIndex& index) const
+{
+	if (m_statsEnabled)
+	{
+		m_stats.parentCalls++;
+	}
+	if (!m_root || !index.isValid())
+    {
+        return QModelIndex();
+    }
+    // get child and parent node references
+    auto childWrapper  = static_cast<QUaNodeWrapper*>(index.internalPointer());
+    Q_CHECK_PTR(childWrapper);
+    auto parentWrapper = static_cast<QUaNodeWrapper*>(childWrapper->parent());
+    Q_CHECK_PTR(parentWrapper);
+    if (parentWrapper == m_root)
+    {
+        return QModelIndex();
+    }
+    // use parent's cached row, no need to search grandparent's children
+    Q_ASSERT(parentWrapper->parent() && 
+        parentWrapper->parent()->children().at(parentWrapper->row()) == parentWrapper);
+    return this->createIndex(parentWrapper->row(), 0, parentWrapper);
+}
+
+template<class N, int I>
+inline int QUaModel<N, I>::rowCount(const QModelIndex& parent) const
+{
+	if (!m_root || parent.column() > 0)
+	{
+		return 0;
+	}
+	QUaNodeWrapper* parentWrapper;
+	// get internal wrapper reference
+	if (!parent.isValid())
+	{
+		parentWrapper = m_root;
+	}
+	else
+	{
+		parentWrapper = static_cast<QUaNodeWrapper*>(parent.internalPointer());
+	}
+	// return number of children
+	Q_CHECK_PTR(parentWrapper);
+	int childCount = parentWrapper->children().count();
+	return childCount;
+}
+
+template<class N, int I>
+inline int QUaModel<N, I>::columnCount(const QModelIndex& parent) const
+{
+	Q_UNUSED(parent);
+	if (!m_root)
+	{
+		return 0;
+	}
+	// minimum 1 column
+	return m_columnCount;
+}
+
+template<class N, int I>
+inline QVariant QUaModel<N, I>::data(const QModelIndex& index, int role) const
+{
+	this->countDataCall(index.column(), role);
+	// early exit for inhandled cases
+	if (!m_root || !index.isValid())
+	{
+		return QVariant();
+	}
+	// NOTE : cheapest tests first, views ask for many roles per cell
+	bool hasSources = !QUaModelBase<N, I>::m_vectDataSourceFuncs.isEmpty();
+	auto source = this->columnDataSource(index.column());
+	// empty if no ColumnDataSource defined for this column or role not served
+	if (hasSources && (!source || !source->m_dataCallback || !source->m_roles.contains(role)))
+	{
+		return QVariant();
+	}
+	// get internal reference
+	auto wrapper = static_cast<QUaNodeWrapper*>(index.internalPointer());
+	// check internal wrapper data is valid, because wrapper->node() is always deleted before wrapper
+	if(!this->isWrapperValid(wrapper))
+	{
+		return QVariant();
+	}
+	// default implementation if no ColumnDataSource has been defined
+	if (!hasSources)
+	{
+		Q_ASSERT(m_columnCount == 1);
+		return tr("");
+	}
+	// use user-defined ColumnDataSource
+	return this->columnData(source, wrapper, index.column(), role);
+}
+
+template<class N, int I>
+inline bool QUaModel<N, I>::setData(const QModelIndex& index, const QVariant& value, int role)
+{
+	bool ok = false;
+	{
+		QUaModelStatsTimer timer(this->statsTraitCalls(), this->statsTraitNsecs(), "SetData");
+		ok = QUaModelItemTraits::SetData<N, I>(this->nodeFromIndex(index), index.column(), value);
+	}
+	if (ok && index.isValid())
+	{
+		// NOTE : hash might depend on data (e.g. value types), 
+		//        descendants are not affected
+		auto wrapper = static_cast<QUaNodeWrapper*>(index.internalPointer());
+		this->unindexNodes(wrapper, false);
+		this->indexNodes(wrapper, false);
+		// NOTE : column might have no change callback nor change signal
+		wrapper->invalidateCachedData(index.column());
+	}
+	if (ok)
+	{
+		Q_EMIT this->dataChanged(index, index, QVector<int>() << role);
+	}
+	return ok;
+}
+
+template<class N, int I>
+inline Qt::ItemFlags QUaModel<N, I>::flags(const QModelIndex& index) const
+{
+	if (!m_root || !index.isValid())
+	{
+		return Qt::NoItemFlags;
+	}
+	Qt::ItemFlags flags = QAbstractItemModel::flags(index);
 	// test column defined and editable callback defined
-    if (!QUaModelBase<N, I>::m_mapDataSourceFuncs.contains(index.column()) ||
-        !QUaModelBase<N, I>::m_mapDataSourceFuncs[index.column()].m_editableCallback)
+	auto source = this->columnDataSource(index.column());
+	if (!source || !source->m_editableCallback)
 	{
 		return flags;
 	}
 	// test node valid
 	auto wrapper = static_cast<QUaNodeWrapper*>(index.internalPointer());
-	if(!QUaModelItemTraits::IsValid<N, I>(wrapper->node()))
+	if(!this->isWrapperValid(wrapper))
+	{
+		return flags;
+	}
+	// test callback returns true
+	bool editable = false;
+	{
+		QUaModelStatsTimer timer(this->statsCallbackCalls(), this->statsCallbackNsecs(), "editableCallback");
+		editable = source->m_editableCallback(wrapper->node());
+	}
+	if (!editable)
 	{
 		return flags;
 	}
-	// test callback returns true
-    if (!QUaModelBase<N, I>::m_mapDataSourceFuncs[index.column()].m_editableCallback(wrapper->node()))
+	// finally, after all this, item is editable
+	return flags |= Qt::ItemIsEditable;
+}
+
+template<class N, int I>
+inline bool QUaModel<N, I>::removeRows(int row, int count, const QModelIndex& parent)
+{
+	if (!m_root || row < 0 || count <= 0)
+	{
+		return false;
+	}
+	auto parentWrapper = parent.isValid() ?
+		static_cast<QUaNodeWrapper*>(parent.internalPointer()) :
+		m_root;
+	Q_CHECK_PTR(parentWrapper);
+	if (row + count > parentWrapper->children().count())
+	{
+		return false;
+	}
+	this->removeWrappers(parentWrapper->children().mid(row, count));
+	return true;
+}
+
+template<class N, int I>
+inline void QUaModel<N, I>::bindChangeCallbackForColumn(
+	const int& column, 
+	QUaNodeWrapper* wrapper, 
+	const bool& recursive
+)
+{
+	Q_CHECK_PTR(wrapper);
+	auto source = this->columnDataSource(column);
+	if (!source || (!source->m_changeCallback && !this->hasColumnChangeSignals(column)))
+	{
+		return;
+	}
+	if (QUaModelItemTraits::IsValid<N, I>(wrapper->node()) && source->m_changeCallback)
+	{
+		// pass in callback that user needs to call when a value is udpated
+		// store connection in wrapper so can be disconnected when wrapper deleted
+		QUaModelStatsTimer timer(this->statsCallbackCalls(), this->statsCallbackNsecs(), "changeCallback");
+		wrapper->connections() <<
+			source->m_changeCallback(
+				wrapper->node(),
+				wrapper->getChangeCallbackForColumn(column, this)
+			);
+	}
+	if (QUaModelItemTraits::IsValid<N, I>(wrapper->node()))
+	{
+		this->bindChangeSignalsForColumn(column, wrapper);
+	}
+	// check if recursive
+	if (!recursive)
+	{
+		return;
+	}
+	// recurse children
+	for (auto child : wrapper->children())
+	{
+		this->bindChangeCallbackForColumn(column, child);
+	}
+}
+
+template<class N, int I>
+inline void QUaModel<N, I>::bindChangeCallbackForAllColumns(
+	QUaNodeWrapper* wrapper, 
+	const bool& recursive
+)
+{
+	auto& vectDataSourceFuncs = QUaModelBase<N, I>::m_vectDataSourceFuncs;
+	for (int column = 0; column < vectDataSourceFuncs.count(); column++)
+	{
+		if (!vectDataSourceFuncs.at(column).m_changeCallback &&
+			!this->hasColumnChangeSignals(column))
+		{
+			continue;
+		}
+		this->bindChangeCallbackForColumn(column, wrapper, recursive);
+	}
+}
+
+template<class N, int I>
+template<typename X>
+inline typename std::enable_if<std::is_pointer<X>::value, bool>::type
+QUaModel<N, I>::hasColumnChangeSignals(const int& column) const
+{
+	auto& vectDataSourceFuncs = QUaModelBase<N, I>::m_vectDataSourceFuncs;
+	return column >= 0 && column < vectDataSourceFuncs.count() &&
+		!vectDataSourceFuncs.at(column).m_changeSignals.isEmpty();
+}
+
+template<class N, int I>
+template<typename X>
+inline typename std::enable_if<!std::is_pointer<X>::value, bool>::type
+QUaModel<N, I>::hasColumnChangeSignals(const int& column) const
+{
+	// NOTE : signal hub requires QObject pointer nodes
+	Q_UNUSED(column);
+	return false;
+}
+
+template<class N, int I>
+template<typename X>
+inline typename std::enable_if<std::is_pointer<X>::value, void>::type
+QUaModel<N, I>::bindChangeSignalsForColumn(const int& column, QUaNodeWrapper* wrapper)
+{
+	for (auto& changeSignal : QUaModelBase<N, I>::m_vectDataSourceFuncs.at(column).m_changeSignals)
+	{
+		// NOTE : wrapper unsubscribes on destruction
+		if (changeSignal(wrapper->node(), wrapper, wrapper->getChangeCallbackForColumn(column, this)))
+		{
+			wrapper->setHubSubscribed();
+		}
+	}
+}
+
+template<class N, int I>
+template<typename X>
+inline typename std::enable_if<!std::is_pointer<X>::value, void>::type
+QUaModel<N, I>::bindChangeSignalsForColumn(const int& column, QUaNodeWrapper* wrapper)
+{
+	Q_UNUSED(column);
+	Q_UNUSED(wrapper);
+}
+
+template<class N, int I>
+inline void QUaModel<N, I>::unbindChangeSignalsForColumn(const int& column)
+{
+	if (!m_root || !this->hasColumnChangeSignals(column))
+	{
+		return;
+	}
+	QList<QUaNodeWrapper*> wrappers;
+	wrappers << m_root;
+	for (int i = 0; i < wrappers.count(); i++)
+	{
+		auto wrapper = wrappers.at(i);
+		wrappers << wrapper->children();
+		if (!wrapper->isHubSubscribed())
+		{
+			continue;
+		}
+		// NOTE : subscriptions are tagged with their column
+		QUaSignalHub::instance()->unsubscribe(wrapper, column);
+	}
+}
+
+
+template<typename N, int I>
+inline void QUaModel<N, I>::removeWrapper(typename QUaModel<N, I>::QUaNodeWrapper* wrapper)
+{
+	QUaModelTracerScope scope("removeWrapper", "model");
+	auto parent = wrapper->parent();
+	Q_CHECK_PTR(parent);
+	// only use indexes created by model
+	// NOTE : stored rows are kept up to date on every insert and remove
+	int row = wrapper->row();
+	QModelIndex index = this->indexFromWrapper(parent);
+	Q_ASSERT(row < parent->children().count());
+	Q_ASSERT(wrapper == parent->children().at(row));
+	// notify views that row will be removed
+	this->beginRemoveRows(index, row, row);
+	// remove from parent
+	this->discardPendingUpdates(wrapper);
+	this->unindexNodes(wrapper);
+	delete parent->children().takeAt(row);
+	// shift rows of the siblings after the removed one
+	this->reindexChildren(parent, row);
+	// notify views that row removal has finished
+	this->endRemoveRows();
+	// debug only
+	this->debugCheckIndex(index, parent == m_root);
+}
+
+template<typename N, int I>
+inline QVariant QUaModel<N, I>::columnData(
+	const typename QUaModelBase<N, I>::ColumnDataSource* source,
+	QUaNodeWrapper* wrapper,
+	const int& column,
+	const int& role
+) const
+{
+	Q_CHECK_PTR(source);
+	Q_CHECK_PTR(wrapper);
+	if (!source->m_isCached)
+	{
+		QUaModelStatsTimer timer(this->statsCallbackCalls(), this->statsCallbackNsecs(), "dataCallback");
+		return source->m_dataCallback(
+			wrapper->node(),
+			static_cast<Qt::ItemDataRole>(role)
+		);
+	}
+	auto cached = wrapper->cachedData(column, role);
+	if (cached)
+	{
+		return *cached;
+	}
+	QUaModelStatsTimer timer(this->statsCallbackCalls(), this->statsCallbackNsecs(), "dataCallback");
+	QVariant value = source->m_dataCallback(
+		wrapper->node(),
+		static_cast<Qt::ItemDataRole>(role)
+	);
+	wrapper->setCachedData(column, role, value);
+	return value;
+}
+
+template<typename N, int I>
+inline void QUaModel<N, I>::clearColumnCache(const int& column)
+{
+	if (!m_root)
+	{
+		return;
+	}
+	QList<QUaNodeWrapper*> wrappers = m_root->children();
+	for (int i = 0; i < wrappers.count(); i++)
+	{
+		auto wrapper = wrappers.at(i);
+		wrappers << wrapper->children();
+		wrapper->invalidateCachedData(column);
+	}
+}
+
+template<typename N, int I>
+inline void QUaModel<N, I>::indexNodes(
+	QUaNodeWrapper* wrapper,
+	const bool& recursive/* = true*/
+)
+{
+	Q_CHECK_PTR(wrapper);
+	QList<QUaNodeWrapper*> wrappers;
+	wrappers << wrapper;
+	for (int i = 0; i < wrappers.count(); i++)
+	{
+		auto current = wrappers.at(i);
+		if (recursive)
+		{
+			wrappers << current->children();
+		}
+		// ignore root and invalid (e.g. categories)
+		if (!current->parent() || !QUaModelItemTraits::IsValid<N, I>(current->node()))
+		{
+			continue;
+		}
+		uint hash = QUaModelItemTraits::Hash<N, I>(current->node());
+		current->setHash(hash);
+		m_hashNodes.insert(hash, current);
+	}
+}
+
+template<typename N, int I>
+inline void QUaModel<N, I>::unindexNodes(
+	QUaNodeWrapper* wrapper/* = nullptr*/,
+	const bool& recursive/* = true*/
+)
+{
+	if (m_hashNodes.isEmpty())
+	{
+		return;
+	}
+	if (!wrapper)
+	{
+		m_hashNodes.clear();
+		return;
+	}
+	QList<QUaNodeWrapper*> wrappers;
+	wrappers << wrapper;
+	for (int i = 0; i < wrappers.count(); i++)
+	{
+		auto current = wrappers.at(i);
+		if (recursive)
+		{
+			wrappers << current->children();
+		}
+		m_hashNodes.remove(current->hash(), current);
+	}
+}
+
+template<typename N, int I>
+template<typename X>
+inline
+typename std::enable_if<std::is_pointer<X>::value, QList<typename QUaModel<N, I>::QUaNodeWrapper*>>::type
+QUaModel<N, I>::wrappersFromNode(N node) const
+{
+	QList<QUaNodeWrapper*> wrappers;
+	if (!QUaModelItemTraits::IsValid<N, I>(node))
+	{
+		return wrappers;
+	}
+	uint hash = QUaModelItemTraits::Hash<N, I>(node);
+	auto it = m_hashNodes.constFind(hash);
+	while (it != m_hashNodes.constEnd() && it.key() == hash)
+	{
+		// NOTE : hash collisions are possible
+		if (QUaModelItemTraits::IsEqual<N, I>(it.value()->node(), node))
+		{
+			wrappers << it.value();
+		}
+		++it;
+	}
+	return wrappers;
+}
+
+template<typename N, int I>
+template<typename X>
+inline
+typename std::enable_if<!std::is_pointer<X>::value, QList<typename QUaModel<N, I>::QUaNodeWrapper*>>::type
+QUaModel<N, I>::wrappersFromNode(N* node) const
+{
+	QList<QUaNodeWrapper*> wrappers;
+	if (!node || !QUaModelItemTraits::IsValid<N, I>(node))
+	{
+		return wrappers;
+	}
+	uint hash = QUaModelItemTraits::Hash<N, I>(node);
+	auto it = m_hashNodes.constFind(hash);
+	while (it != m_hashNodes.constEnd() && it.key() == hash)
+	{
+		// NOTE : hash collisions are possible
+		if (QUaModelItemTraits::IsEqual<N, I>(it.value()->node(), node))
+		{
+			wrappers << it.value();
+		}
+		++it;
+	}
+	return wrappers;
+}
+
+template<typename N, int I>
+template<typename X>
+inline
+typename std::enable_if<std::is_pointer<X>::value, QModelIndex>::type
+QUaModel<N, I>::indexFromNode(N node, const int& column/* = 0*/) const
+{
+	auto wrappers = this->wrappersFromNode(node);
+	if (wrappers.isEmpty() || column < 0 || column >= m_columnCount)
+	{
+		return QModelIndex();
+	}
+	return this->createIndex(wrappers.first()->row(), column, wrappers.first());
+}
+
+template<typename N, int I>
+template<typename X>
+inline
+typename std::enable_if<!std::is_pointer<X>::value, QModelIndex>::type
+QUaModel<N, I>::indexFromNode(N* node, const int& column/* = 0*/) const
+{
+	auto wrappers = this->wrappersFromNode(node);
+	if (wrappers.isEmpty() || column < 0 || column >= m_columnCount)
+	{
+		return QModelIndex();
+	}
+	return this->createIndex(wrappers.first()->row(), column, wrappers.first());
+}
+
+template<typename N, int I>
+inline QModelIndex QUaModel<N, I>::indexFromWrapper(
+	QUaNodeWrapper* wrapper
+) const
+{
+	if (!wrapper || !wrapper->parent())
+	{
+		return QModelIndex();
+	}
+	Q_ASSERT(wrapper->row() >= 0);
+	return this->createIndex(wrapper->row(), 0, wrapper);
+}
+
+template<typename N, int I>
+inline const typename QUaModelBase<N, I>::ColumnDataSource* 
+QUaModel<N, I>::columnDataSource(
+	const int& column
+) const
+{
+	auto& vectDataSourceFuncs = QUaModelBase<N, I>::m_vectDataSourceFuncs;
+	if (column < 0 || column >= vectDataSourceFuncs.count())
+	{
+		return nullptr;
+	}
+	auto source = vectDataSourceFuncs.constData() + column;
+	return source->m_isDefined ? source : nullptr;
+}
+
+template<typename N, int I>
+inline void QUaModel<N, I>::removeWrappers(const QList<QUaNodeWrapper*>& wrappers)
+{
+	QUaModelTracerScope scope("removeWrappers", "model");
+	QList<QUaNodeWrapper*> listWrappers = wrappers;
+	if (listWrappers.isEmpty())
+	{
+		return;
+	}
+	// group rows by parent, ignore wrappers that go away with an ancestor
+	QSet<QUaNodeWrapper*> setWrappers;
+	for (auto wrapper : listWrappers)
+	{
+		setWrappers.insert(wrapper);
+	}
+	QHash<QUaNodeWrapper*, QVector<int>> hashRows;
+	QList<QUaNodeWrapper*> listParents;
+	for (auto wrapper : listWrappers)
+	{
+		Q_CHECK_PTR(wrapper);
+		auto parent = wrapper->parent();
+		Q_CHECK_PTR(parent);
+		bool ancestorRemoved = false;
+		for (auto ancestor = parent; ancestor && !ancestorRemoved; ancestor = ancestor->parent())
+		{
+			ancestorRemoved = setWrappers.contains(ancestor);
+		}
+		if (ancestorRemoved)
+		{
+			continue;
+		}
+		if (!hashRows.contains(parent))
+		{
+			listParents << parent;
+		}
+		Q_ASSERT(parent->children().at(wrapper->row()) == wrapper);
+		hashRows[parent] << wrapper->row();
+	}
+	for (auto parent : listParents)
+	{
+		auto rows = hashRows.take(parent);
+		std::sort(rows.begin(), rows.end());
+		rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+		// only use indexes created by model
+		QModelIndex index = this->indexFromWrapper(parent);
+		auto& children = parent->children();
+		// remove ranges bottom up, so rows of the ranges above stay valid
+		int j = rows.count() - 1;
+		while (j >= 0)
+		{
+			int last  = rows.at(j);
+			int first = last;
+			while (j > 0 && rows.at(j - 1) == first - 1)
+			{
+				first--;
+				j--;
+			}
+			j--;
+			// notify views that rows will be removed
+			this->beginRemoveRows(index, first, last);
+			for (int row = first; row <= last; row++)
+			{
+				auto wrapper = children.at(row);
+				this->discardPendingUpdates(wrapper);
+				this->unindexNodes(wrapper);
+				delete wrapper;
+			}
+			children.erase(children.begin() + first, children.begin() + last + 1);
+			// shift rows of the siblings after the removed range
+			this->reindexChildren(parent, first);
+			// notify views that rows removal has finished
+			this->endRemoveRows();
+		}
+		// debug only
+		this->debugCheckIndex(index, parent == m_root);
+	}
+}
+
+template<typename N, int I>
+inline void QUaModel<N, I>::detachWrapper(QUaNodeWrapper* wrapper)
+{
+	Q_CHECK_PTR(wrapper);
+	QList<QUaNodeWrapper*> wrappers;
+	wrappers << wrapper;
+	for (int i = 0; i < wrappers.count(); i++)
+	{
+		auto current = wrappers.at(i);
+		current->detachNode();
+		wrappers << current->children();
+	}
+}
+
+template<typename N, int I>
+inline void QUaModel<N, I>::markDirty(
+	QUaNodeWrapper* wrapper,
+	const int& column
+)
+{
+	wrapper->invalidateCachedData(column);
+	m_setDirtyCells.insert(qMakePair(wrapper, column));
+	Q_EMIT m_eventer.nodeChanged(wrapper, column);
+	if (m_timerUpdates.isActive())
+	{
+		return;
+	}
+	// respect min period since last flush
+	int delay = 0;
+	if (m_maxUpdateRate > 0 && m_timeLastUpdate.isValid())
+	{
+		delay = qMax(0, 1000 / m_maxUpdateRate - static_cast<int>(m_timeLastUpdate.elapsed()));
+	}
+	m_timerUpdates.start(delay);
+}
+
+template<typename N, int I>
+inline void QUaModel<N, I>::processPendingUpdates()
+{
+	QUaModelTracerScope scope("processPendingUpdates", "model");
+	m_timerUpdates.stop();
+	m_timeLastUpdate.start();
+	if (m_setDirtyCells.isEmpty())
+	{
+		return;
+	}
+	// NOTE : swap in case a dataChanged handler marks more cells dirty
+	QSet<QPair<QUaNodeWrapper*, int>> setDirtyCells;
+	setDirtyCells.swap(m_setDirtyCells);
+	// group dirty rows by parent and column
+	QHash<QUaNodeWrapper*, QMap<int, QVector<int>>> hashByParent;
+	for (auto& cell : setDirtyCells)
+	{
+		// skip columns removed meanwhile
+		if (cell.second >= m_columnCount)
+		{
+			continue;
+		}
+		auto wrapper = cell.first;
+		hashByParent[wrapper->parent()][cell.second] << wrapper->row();
+	}
+	// merge into rectangles
+	struct Rect
+	{
+		int firstRow;
+		int lastRow;
+		int firstCol;
+		int lastCol;
+	};
+	for (auto it = hashByParent.begin(); it != hashByParent.end(); ++it)
+	{
+		auto parent = it.key();
+		QVector<Rect> rects;
+		// rectangle indexes by row range, of the previous column
+		QHash<QPair<int, int>, int> hashPrevRuns;
+		int prevColumn = -2;
+		for (auto itCol = it.value().begin(); itCol != it.value().end(); ++itCol)
+		{
+			int column = itCol.key();
+			auto& rows = itCol.value();
+			std::sort(rows.begin(), rows.end());
+			QHash<QPair<int, int>, int> hashCurrRuns;
+			int i = 0;
+			while (i < rows.count())
+			{
+				// find contiguous run of rows
+				int j = i;
+				while (j + 1 < rows.count() && rows.at(j + 1) == rows.at(j) + 1)
+				{
+					j++;
+				}
+				auto run = qMakePair(rows.at(i), rows.at(j));
+				// extend rectangle of previous column if same rows
+				if (prevColumn == column - 1 && hashPrevRuns.contains(run))
+				{
+					int k = hashPrevRuns.value(run);
+					rects[k].lastCol = column;
+					hashCurrRuns.insert(run, k);
+				}
+				else
+				{
+					hashCurrRuns.insert(run, rects.count());
+					rects << Rect{ run.first, run.second, column, column };
+				}
+				i = j + 1;
+			}
+			hashPrevRuns.swap(hashCurrRuns);
+			prevColumn = column;
+		}
+		auto& children = parent->children();
+		for (auto& rect : rects)
+		{
+			Q_EMIT this->dataChanged(
+				this->createIndex(rect.firstRow, rect.firstCol, children.at(rect.firstRow)),
+				this->createIndex(rect.lastRow , rect.lastCol , children.at(rect.lastRow )),
+				this->columnRoles(rect.firstCol, rect.lastCol)
+			);
+		}
+	}
+}
+
+template<typename N, int I>
+inline QVector<int> QUaModel<N, I>::columnRoles(
+	const int& firstColumn,
+	const int& lastColumn
+) const
+{
+	QVector<int> roles;
+	for (int column = firstColumn; column <= lastColumn; column++)
 	{
-		return flags;
+		auto source = this->columnDataSource(column);
+		if (!source || source->m_roles.isEmpty())
+		{
+			return QVector<int>();
+		}
+		for (auto role : source->m_roles.roles())
+		{
+			if (!roles.contains(role))
+			{
+				roles << role;
+			}
+		}
 	}
-	// finally, after all this, item is editable
-	return flags |= Qt::ItemIsEditable;
+	return roles;
 }
 
-template<class N, int I>
-inline void QUaModel<N, I>::bindChangeCallbackForColumn(
-	const int& column, 
-	QUaNodeWrapper* wrapper, 
-	const bool& recursive
+template<typename N, int I>
+inline void QUaModel<N, I>::discardPendingUpdates(
+	QUaNodeWrapper* wrapper/* = nullptr*/
 )
 {
-	Q_CHECK_PTR(wrapper);
-	if (QUaModelItemTraits::IsValid<N, I>(wrapper->node()) &&
-        QUaModelBase<N, I>::m_mapDataSourceFuncs[column].m_changeCallback)
+	if (m_setDirtyCells.isEmpty())
 	{
-		// pass in callback that user needs to call when a value is udpated
-		// store connection in wrapper so can be disconnected when wrapper deleted
-		wrapper->connections() <<
-            QUaModelBase<N, I>::m_mapDataSourceFuncs[column].m_changeCallback(
-				wrapper->node(),
-				wrapper->getChangeCallbackForColumn(column, this)
-			);
+		return;
 	}
-	// check if recursive
-	if (!recursive)
+	if (!wrapper)
 	{
+		m_setDirtyCells.clear();
 		return;
 	}
-	// recurse children
+	for (int column = 0; column < m_columnCount; column++)
+	{
+		m_setDirtyCells.remove(qMakePair(wrapper, column));
+	}
 	for (auto child : wrapper->children())
 	{
-		this->bindChangeCallbackForColumn(column, child);
+		this->discardPendingUpdates(child);
 	}
 }
 
-template<class N, int I>
-inline void QUaModel<N, I>::bindChangeCallbackForAllColumns(
-	QUaNodeWrapper* wrapper, 
-	const bool& recursive
-)
+template<typename N, int I>
+inline void QUaModel<N, I>::reindexChildren(
+	QUaNodeWrapper* parent,
+	const int& first/* = 0*/
+) const
 {
-    if (!QUaModelBase<N, I>::m_mapDataSourceFuncs.isEmpty())
+	Q_CHECK_PTR(parent);
+	auto& children = parent->children();
+	for (int row = first; row < children.count(); row++)
 	{
-        for (auto column : QUaModelBase<N, I>::m_mapDataSourceFuncs.keys())
-		{
-			this->bindChangeCallbackForColumn(column, wrapper, recursive);
-		}
+		children.at(row)->setRow(row);
 	}
 }
 
+template<typename N, int I>
+inline void QUaModel<N, I>::reindexChildrenRecursive(
+	QUaNodeWrapper* parent
+) const
+{
+	this->reindexChildren(parent);
+	for (auto child : parent->children())
+	{
+		this->reindexChildrenRecursive(child);
+	}
+}
 
 template<typename N, int I>
-inline void QUaModel<N, I>::removeWrapper(typename QUaModel<N, I>::QUaNodeWrapper* wrapper)
+inline void QUaModel<N, I>::debugCheckIndex(
+	const QModelIndex& index,
+	const bool& isRoot/* = false*/
+) const
 {
-	auto parent = wrapper->parent();
-	Q_CHECK_PTR(parent);
-	// only use indexes created by model
-	int row = wrapper->index().row();
-	QModelIndex index = parent->index();
-	// when deleteing a node of type N that has children of type N, 
-	// QObject::destroyed is triggered from top to bottom without 
-	// giving a change for the model to update its indices and rows wont match
-	if (row >= parent->children().count() ||
-		wrapper != parent->children().at(row))
-	{
-		// force reindexing
-		for (int r = 0; r < parent->children().count(); r++)
-		{
-			this->index(r, 0, index);
-		}
-		row = wrapper->index().row();
+	if (!m_checkIndexes)
+	{
+		return;
 	}
-#if QT_VERSION >= QT_VERSION_CHECK(5, 11, 0)
-	Q_ASSERT(this->checkIndex(this->index(row, 0, index), QAbstractItemModel::CheckIndexOption::IndexIsValid));
-#else
-	Q_ASSERT(this->checkIndex(this->index(row, 0, index)));
-#endif
-	Q_ASSERT(wrapper == parent->children().at(row));
-	// notify views that row will be removed
-	this->beginRemoveRows(index, row, row);
-	// remove from parent
-	delete parent->children().takeAt(row);
-	// notify views that row removal has finished
-	this->endRemoveRows();
-	// force index re-creation (indirectly)
-	// so we can delete multiple rows in a loop inmediatly (without having to queue them)
 	bool indexOk = this->checkIndexRecursive(
 		index,
 #if QT_VERSION >= QT_VERSION_CHECK(5, 11, 0)
 		QAbstractItemModel::CheckIndexOption::IndexIsValid,
 #endif
-		parent == m_root
+		isRoot
 	);
 	Q_ASSERT(indexOk);
 	Q_UNUSED(indexOk);
@@ -712,18 +2800,30 @@ inline QUaModel<N, I>::QUaNodeWrapper::QUaNodeWrapper(
 	/*QUaModel<N, I>::*/QUaNodeWrapper* parent/* = nullptr*/,
 	const bool& recursive/* = true*/) :
 	m_node(node),
+	m_userData(nullptr),
 	m_parent(parent),
-	m_userData(nullptr)
+	m_row(-1),
+	m_hash(0),
+	m_hubSubscribed(false),
+	m_fetched(false),
+	m_hasChildrenCached(false),
+	m_hasChildren(false)
 {
 	// m_node = nullptr must be supported for type model and category model
 	// NOTE : QUaModelItemTraits methods must handle nullptr (or invalid) m_node
 	// subscribe to node destruction, store connection to disconnect on destructor
-	QMetaObject::Connection conn = QUaModelItemTraits::DestroyCallback<N, I>(
-		this->node(),
-        [this]() {
-			this->m_node = QUaModelItemTraits::GetInvalid<N, I>();
-        }
-	);
+	// NOTE : wrapper has no model reference, so trait calls made by the wrapper 
+	//        are traced and watched but not added to model stats
+	QMetaObject::Connection conn;
+	{
+		QUaModelStatsTimer timer(nullptr, nullptr, "DestroyCallback");
+		conn = QUaModelItemTraits::DestroyCallback<N, I>(
+			this->node(),
+			[this]() {
+				this->m_node = QUaModelItemTraits::GetInvalid<N, I>();
+			}
+		);
+	}
 	if (conn)
 	{
 		m_connections << conn;
@@ -734,11 +2834,7 @@ inline QUaModel<N, I>::QUaNodeWrapper::QUaNodeWrapper(
 		return;
 	}
 	// build children tree
-	auto children = QUaModelItemTraits::GetChildren<N, I>(this->node());
-	for (auto child : children)
-	{
-		m_children << new QUaModel<N, I>::QUaNodeWrapper(child, this);
-	}
+	this->buildChildren();
 }
 
 template<class N, int I>
@@ -748,7 +2844,39 @@ inline QUaModel<N, I>::QUaNodeWrapper::~QUaNodeWrapper()
 	{
 		QObject::disconnect(m_connections.takeFirst());
 	}
-	qDeleteAll(m_children);
+	if (m_hubSubscribed)
+	{
+		QUaSignalHub::instance()->unsubscribe(this);
+	}
+	// NOTE : flatten sub-tree and destroy it iteratively instead of a 
+	//        recursive cascade, each descendant is destroyed without children
+	//        and all their blocks go back to the pool in a single release
+	QList<QUaNodeWrapper*> descendants;
+	descendants.swap(m_children);
+	for (int i = 0; i < descendants.count(); i++)
+	{
+		auto descendant = descendants.at(i);
+		descendants << descendant->m_children;
+		descendant->m_children.clear();
+	}
+	for (auto descendant : descendants)
+	{
+		descendant->~QUaNodeWrapper();
+	}
+	QUaNodeWrapperPool::releaseAll(descendants);
+}
+
+template<class N, int I>
+inline void* QUaModel<N, I>::QUaNodeWrapper::operator new(std::size_t size)
+{
+	Q_ASSERT(size == sizeof(QUaNodeWrapper));
+	return QUaNodeWrapperPool::allocate();
+}
+
+template<class N, int I>
+inline void QUaModel<N, I>::QUaNodeWrapper::operator delete(void* ptr)
+{
+	QUaNodeWrapperPool::release(ptr);
 }
 
 template<typename N, int I>
@@ -811,9 +2939,9 @@ QUaModel<N, I>::connectNodeAddedCallback(
 )
 {
 	return QObject::connect(&m_eventer, &QUaModelBaseEventer::nodeAdded, context,
-	[nodeAddedCallback](void * v_wrapper) {
+	[this, nodeAddedCallback](void * v_wrapper) {
 		auto wrapper = static_cast<QUaNodeWrapper*>(v_wrapper);
-		nodeAddedCallback(wrapper->node(), wrapper->index());
+		nodeAddedCallback(wrapper->node(), this->indexFromWrapper(wrapper));
 	}, type);
 }
 
@@ -827,9 +2955,41 @@ QUaModel<N, I>::connectNodeAddedCallback(
 )
 {
 	return QObject::connect(&m_eventer, &QUaModelBaseEventer::nodeAdded, context,
-	[nodeAddedCallback](void* v_wrapper) {
+	[this, nodeAddedCallback](void* v_wrapper) {
+		auto wrapper = static_cast<QUaNodeWrapper*>(v_wrapper);
+		nodeAddedCallback(wrapper->node(), this->indexFromWrapper(wrapper));
+	}, type);
+}
+
+template<typename N, int I>
+template<typename X, typename M>
+inline typename std::enable_if<std::is_pointer<X>::value, QMetaObject::Connection>::type 
+QUaModel<N, I>::connectNodeChangedCallback(
+	const QObject* context,
+	M nodeChangedCallback,
+	Qt::ConnectionType type/* = Qt::AutoConnection*/
+)
+{
+	return QObject::connect(&m_eventer, &QUaModelBaseEventer::nodeChanged, context,
+	[this, nodeChangedCallback](void * v_wrapper, int column) {
+		auto wrapper = static_cast<QUaNodeWrapper*>(v_wrapper);
+		nodeChangedCallback(wrapper->node(), this->createIndex(wrapper->row(), column, wrapper));
+	}, type);
+}
+
+template<typename N, int I>
+template<typename X, typename M>
+inline typename std::enable_if<!std::is_pointer<X>::value, QMetaObject::Connection>::type 
+QUaModel<N, I>::connectNodeChangedCallback(
+	const QObject* context,
+	M nodeChangedCallback,
+	Qt::ConnectionType type/* = Qt::AutoConnection*/
+)
+{
+	return QObject::connect(&m_eventer, &QUaModelBaseEventer::nodeChanged, context,
+	[this, nodeChangedCallback](void* v_wrapper, int column) {
 		auto wrapper = static_cast<QUaNodeWrapper*>(v_wrapper);
-		nodeAddedCallback(wrapper->node(), wrapper->index());
+		nodeChangedCallback(wrapper->node(), this->createIndex(wrapper->row(), column, wrapper));
 	}, type);
 }
 
@@ -842,7 +3002,8 @@ QUaModel<N, I>::setColumnDataSource(
 	const QString& strHeader, 
 	M1 dataCallback,    // std::function<QVariant(X, const Qt::ItemDataRole&)>
 	M2 changeCallback,  // std::function<QList<QMetaObject::Connection>(X, std::function<void(void)>)>
-	M3 editableCallback // std::function<bool(X)>
+	M3 editableCallback,// std::function<bool(X)>
+	const QVector<int>& roles/* = QVector<int>()*/
 )
 {
 	Q_ASSERT(column >= 0);
@@ -850,17 +3011,28 @@ QUaModel<N, I>::setColumnDataSource(
 	{
 		return;
 	}
-    QUaModelBase<N, I>::m_mapDataSourceFuncs.insert(
-		column,
-		{
-			strHeader,
-			dataCallback, 
-			changeCallback, 
-			editableCallback
-		}
-	);
+	auto& vectDataSourceFuncs = QUaModelBase<N, I>::m_vectDataSourceFuncs;
+	if (column >= vectDataSourceFuncs.count())
+	{
+		vectDataSourceFuncs.resize(column + 1);
+	}
+	// old cached data belongs to old callback
+	if (vectDataSourceFuncs.at(column).m_isCached)
+	{
+		this->clearColumnCache(column);
+	}
+	// old change signals are replaced too, drop their subscriptions
+	this->unbindChangeSignalsForColumn(column);
+	vectDataSourceFuncs[column] = {
+		strHeader,
+		dataCallback,
+		changeCallback,
+		editableCallback,
+		QUaModelColumnRoles(roles),
+		true
+	};
 	// call bind function recusivelly for each existing instance
-    if (QUaModelBase<N, I>::m_mapDataSourceFuncs[column].m_changeCallback)
+	if (vectDataSourceFuncs.at(column).m_changeCallback)
 	{
 		this->bindChangeCallbackForColumn(column, m_root);
 	}
@@ -877,7 +3049,8 @@ QUaModel<N, I>::setColumnDataSource(
 	const QString& strHeader,
 	M1 dataCallback,    // std::function<QVariant(X*, const Qt::ItemDataRole&)>
 	M2 changeCallback,  // std::function<QList<QMetaObject::Connection>(X*, std::function<void(void)>)>
-	M3 editableCallback // std::function<bool(X*)>
+	M3 editableCallback,// std::function<bool(X*)>
+	const QVector<int>& roles/* = QVector<int>()*/
 )
 {
 	Q_ASSERT(column >= 0);
@@ -885,17 +3058,26 @@ QUaModel<N, I>::setColumnDataSource(
 	{
 		return;
 	}
-    QUaModelBase<N, I>::m_mapDataSourceFuncs.insert(
-		column,
-		{
-			strHeader,
-			dataCallback,
-			changeCallback,
-			editableCallback
-		}
-	);
+	auto& vectDataSourceFuncs = QUaModelBase<N, I>::m_vectDataSourceFuncs;
+	if (column >= vectDataSourceFuncs.count())
+	{
+		vectDataSourceFuncs.resize(column + 1);
+	}
+	// old cached data belongs to old callback
+	if (vectDataSourceFuncs.at(column).m_isCached)
+	{
+		this->clearColumnCache(column);
+	}
+	vectDataSourceFuncs[column] = {
+		strHeader,
+		dataCallback,
+		changeCallback,
+		editableCallback,
+		QUaModelColumnRoles(roles),
+		true
+	};
 	// call bind function recusivelly for each existing instance
-    if (QUaModelBase<N, I>::m_mapDataSourceFuncs[column].m_changeCallback)
+	if (vectDataSourceFuncs.at(column).m_changeCallback)
 	{
 		this->bindChangeCallbackForColumn(column, m_root);
 	}
@@ -903,6 +3085,56 @@ QUaModel<N, I>::setColumnDataSource(
 	m_columnCount = (std::max)(m_columnCount, column + 1);
 }
 
+template<typename N, int I>
+template<typename Func, typename X>
+inline
+typename std::enable_if<std::is_pointer<X>::value, void>::type
+QUaModel<N, I>::addColumnChangeSignal(
+	const int& column,
+	Func signal
+)
+{
+	typedef typename QtPrivate::FunctionPointer<Func>::Object T;
+	Q_ASSERT_X(this->columnDataSource(column),
+		"QUaModel::addColumnChangeSignal",
+		"Call setColumnDataSource first.");
+	if (!this->columnDataSource(column))
+	{
+		return;
+	}
+	std::function<bool(N, const void*, const std::function<void()>&)> changeSignal = 
+	[signal, column](N node, const void* subscriber, const std::function<void()>& callback) {
+		auto sender = qobject_cast<T*>(node);
+		if (!sender)
+		{
+			return false;
+		}
+		// NOTE : tagged with column, so removing column drops it
+		QUaSignalHub::instance()->subscribe(sender, signal, subscriber, callback, column);
+		return true;
+	};
+	QUaModelBase<N, I>::m_vectDataSourceFuncs[column].m_changeSignals << changeSignal;
+	// subscribe each existing instance, only to the new signal
+	if (!m_root)
+	{
+		return;
+	}
+	QList<QUaNodeWrapper*> wrappers = m_root->children();
+	for (int i = 0; i < wrappers.count(); i++)
+	{
+		auto wrapper = wrappers.at(i);
+		wrappers << wrapper->children();
+		if (!QUaModelItemTraits::IsValid<N, I>(wrapper->node()))
+		{
+			continue;
+		}
+		if (changeSignal(wrapper->node(), wrapper, wrapper->getChangeCallbackForColumn(column, this)))
+		{
+			wrapper->setHubSubscribed();
+		}
+	}
+}
+
 template<typename N, int I>
 template<typename X>
 inline 
@@ -946,15 +3178,15 @@ QUaModel<N, I>::QUaNodeWrapper::findChildByData(const void* childData) const
 }
 
 template<class N, int I>
-inline QModelIndex QUaModel<N, I>::QUaNodeWrapper::index() const
+inline int QUaModel<N, I>::QUaNodeWrapper::row() const
 {
-	return m_index;
+	return m_row;
 }
 
 template<class N, int I>
-inline void QUaModel<N, I>::QUaNodeWrapper::setIndex(const QModelIndex& index)
+inline void QUaModel<N, I>::QUaNodeWrapper::setRow(const int& row)
 {
-	m_index = index;
+	m_row = row;
 }
 
 template<class N, int I>
@@ -964,6 +3196,12 @@ inline typename QUaModel<N, I>::QUaNodeWrapper*
 	return m_parent;
 }
 
+template<class N, int I>
+inline void QUaModel<N, I>::QUaNodeWrapper::setParent(QUaNodeWrapper* parent)
+{
+	m_parent = parent;
+}
+
 template<typename N, int I>
 template<typename X>
 inline
@@ -997,6 +3235,137 @@ inline QList<typename QUaModel<N, I>::QUaNodeWrapper*>&
 	return m_children;
 }
 
+template<class N, int I>
+inline void QUaModel<N, I>::QUaNodeWrapper::buildChildren(const bool& recursive/* = true*/)
+{
+	QList<N> children;
+	{
+		QUaModelStatsTimer timer(nullptr, nullptr, "GetChildren");
+		children = QUaModelItemTraits::GetChildren<N, I>(this->node());
+	}
+	this->buildChildren(children, recursive);
+}
+
+template<class N, int I>
+inline void QUaModel<N, I>::QUaNodeWrapper::buildChildren(
+	const QList<N>& children, 
+	const bool& recursive
+)
+{
+	m_fetched = true;
+	for (auto child : children)
+	{
+		auto wrapper = new QUaModel<N, I>::QUaNodeWrapper(child, this, recursive);
+		wrapper->m_row = m_children.count();
+		m_children << wrapper;
+	}
+}
+
+template<class N, int I>
+inline uint QUaModel<N, I>::QUaNodeWrapper::hash() const
+{
+	return m_hash;
+}
+
+template<class N, int I>
+inline void QUaModel<N, I>::QUaNodeWrapper::setHash(const uint& hash)
+{
+	m_hash = hash;
+}
+
+template<class N, int I>
+inline bool QUaModel<N, I>::QUaNodeWrapper::isFetched() const
+{
+	return m_fetched;
+}
+
+template<class N, int I>
+inline bool QUaModel<N, I>::QUaNodeWrapper::isHasChildrenCached() const
+{
+	return m_hasChildrenCached;
+}
+
+template<class N, int I>
+inline bool QUaModel<N, I>::QUaNodeWrapper::cachedHasChildren() const
+{
+	return m_hasChildren;
+}
+
+template<class N, int I>
+inline void QUaModel<N, I>::QUaNodeWrapper::setCachedHasChildren(const bool& hasChildren)
+{
+	m_hasChildrenCached = true;
+	m_hasChildren = hasChildren;
+}
+
+template<class N, int I>
+inline const QVariant* QUaModel<N, I>::QUaNodeWrapper::cachedData(
+	const int& column, 
+	const int& role
+) const
+{
+	for (auto& data : m_cache)
+	{
+		if (data.m_column == column && data.m_role == role)
+		{
+			return &data.m_value;
+		}
+	}
+	return nullptr;
+}
+
+template<class N, int I>
+inline void QUaModel<N, I>::QUaNodeWrapper::setCachedData(
+	const int& column, 
+	const int& role, 
+	const QVariant& value
+)
+{
+	for (auto& data : m_cache)
+	{
+		if (data.m_column == column && data.m_role == role)
+		{
+			data.m_value = value;
+			return;
+		}
+	}
+	m_cache.append({ column, role, value });
+}
+
+template<class N, int I>
+inline void QUaModel<N, I>::QUaNodeWrapper::invalidateCachedData(const int& column)
+{
+	if (m_cache.isEmpty())
+	{
+		return;
+	}
+	m_cache.erase(std::remove_if(m_cache.begin(), m_cache.end(),
+	[column](const CachedData& data) {
+		return data.m_column == column;
+	}), m_cache.end());
+}
+
+template<class N, int I>
+inline int QUaModel<N, I>::QUaNodeWrapper::cachedDataCount() const
+{
+	return m_cache.count();
+}
+
+template<class N, int I>
+inline quint64 QUaModel<N, I>::QUaNodeWrapper::cachedDataBytes() const
+{
+	quint64 bytes = QUaModelMemoryReport::vectorBytes(m_cache);
+	// NOTE : only strings are common and large enough to matter
+	for (auto& data : m_cache)
+	{
+		if (data.m_value.type() == QVariant::String)
+		{
+			bytes += QUaModelMemoryReport::stringBytes(data.m_value.toString());
+		}
+	}
+	return bytes;
+}
+
 template<class N, int I>
 inline QList<QMetaObject::Connection>& 
 	QUaModel<N, I>::QUaNodeWrapper::connections()
@@ -1004,20 +3373,45 @@ inline QList<QMetaObject::Connection>&
 	return m_connections;
 }
 
+template<class N, int I>
+inline void QUaModel<N, I>::QUaNodeWrapper::setHubSubscribed()
+{
+	m_hubSubscribed = true;
+}
+
+template<class N, int I>
+inline bool QUaModel<N, I>::QUaNodeWrapper::isHubSubscribed() const
+{
+	return m_hubSubscribed;
+}
+
+template<class N, int I>
+inline void QUaModel<N, I>::QUaNodeWrapper::detachNode()
+{
+	while (m_connections.count() > 0)
+	{
+		QObject::disconnect(m_connections.takeFirst());
+	}
+	if (m_hubSubscribed)
+	{
+		QUaSignalHub::instance()->unsubscribe(this);
+		m_hubSubscribed = false;
+	}
+	m_node = QUaModelItemTraits::GetInvalid<N, I>();
+}
+
 template<class N, int I>
 inline std::function<void()> 
 	QUaModel<N, I>::QUaNodeWrapper::getChangeCallbackForColumn(
 		const int& column, 
-		QAbstractItemModel* model
+		QUaModel<N, I>* model
 	)
 {
+	// NOTE : do not emit here, several signals (e.g. value and timestamps) 
+	//        usually change the same cell, so coalesce them
 	return [this, column, model]()
 	{
-		QModelIndex index = (column == m_index.column()) ?
-			m_index :
-			m_index.sibling(m_index.row(), column);
-		Q_ASSERT(index.isValid());
-		Q_EMIT model->dataChanged(index, index, model->roleNames().keys().toVector());
+		model->markDirty(this, column);
 	};
 }
 
@@ -1057,6 +3451,7 @@ public:
 protected:
 	inline bool filterAcceptsRow(int sourceRow, const QModelIndex& sourceParent) const override
 	{
+		QUaModelOperationScope operation("filterAcceptsRow");
 		// call callback if defined, else call base implementation
 		return m_filterAcceptsRow ? 
 			m_filterAcceptsRow(sourceRow, sourceParent) : 
@@ -1064,6 +3459,7 @@ protected:
 	};
 	inline bool lessThan(const QModelIndex& left, const QModelIndex& right) const override
 	{
+		QUaModelOperationScope operation("lessThan");
 		// call callback if defined, else call base implementation
 		return m_lessThan ? 
 			m_lessThan(left, right) : 
@@ -2,6 +2,7 @@
 #define QUAHASMODELITEMTRAITS_H
 
 #include <QList>
+#include <QHash>
 #include <type_traits>
 #include <functional>
 
@@ -47,6 +48,27 @@ public:
 		Q_UNUSED(callback);
 		return QMetaObject::Connection();
 	}
+	// notify when T was moved to another parent or position by calling *callback* 
+	// with the new parent and the new row among its children (-1 if last)
+	// NOTE : a moved T must not be notified through NewChildCallback or DestroyCallback
+	// default implementation if T is type
+	template<typename T, int I = 0> static
+	typename std::enable_if<!std::is_pointer<T>::value, QMetaObject::Connection>::type
+	MoveCallback(T* n, const std::function<void(T&, int)>& callback) // NOTE : template M does not work
+	{
+		Q_UNUSED(n);
+		Q_UNUSED(callback);
+		return QMetaObject::Connection();
+	}
+	// default implementation if T is pointer
+	template<typename T, int I = 0> static
+	typename std::enable_if<std::is_pointer<T>::value, QMetaObject::Connection>::type
+	MoveCallback(T n, const std::function<void(T, int)>& callback) // NOTE : template M does not work
+	{
+		Q_UNUSED(n);
+		Q_UNUSED(callback);
+		return QMetaObject::Connection();
+	}
 	// return a list of children of T
 	// default implementation if T is type
 	template<typename T, int I = 0> static
@@ -110,6 +132,21 @@ public:
 	{
 		return n1 == n2;
 	}
+	// return hash of T, must be consistent with IsEqual (equal Ts have equal hash)
+	// default implementation if T is type (identity, same as default IsEqual)
+	template<typename T, int I = 0> static
+	typename std::enable_if<!std::is_pointer<T>::value, uint>::type
+	Hash(const T* n)
+	{
+		return qHash(static_cast<const void*>(n));
+	}
+	// default implementation if T is pointer
+	template<typename T, int I = 0> static
+	typename std::enable_if<std::is_pointer<T>::value, uint>::type
+	Hash(const T n)
+	{
+		return qHash(static_cast<const void*>(n));
+	}
 	// set data into T (reference)
 	// default implementation if T is type
 	template<typename T, int I = 0> static
@@ -0,0 +1,531 @@
+#ifndef QUAMODELTRACE_H
+#define QUAMODELTRACE_H
+
+#include <QUaModel>
+#include <QFile>
+#include <QDataStream>
+#include <QThread>
+#include <QCoreApplication>
+
+// binary trace of the mutations received by a model :
+//   header : magic (quint32), version (quint16), column count (qint32)
+//   record : type (quint8), microseconds since previous record (quint32),
+//            node id (quint32), [parent id (quint32) if Added or Moved],
+//            [column (quint16) if Changed], [row (qint32) if Moved]
+// NOTE : node ids are assigned by the recorder, 0 is the (invisible) root,
+//        version 1 files have no Moved records and are still readable
+struct QUaModelTraceRecord
+{
+	enum Type
+	{
+		Added   = 0,
+		Removed = 1,
+		Changed = 2,
+		Reset   = 3,
+		Moved   = 4
+	};
+	quint8  type;
+	// microseconds since recording started
+	quint64 timeUsecs;
+	quint32 id;
+	quint32 parentId;
+	int     column;
+	// row under new parent if Moved
+	int     row;
+};
+
+const quint32 QUaModelTraceMagic   = 0x51554154; // QUAT
+const quint16 QUaModelTraceVersion = 2;
+
+// records mutations received by a model into a trace file
+// NOTE : nodes in model when recording starts (or after a reset) are 
+//        recorded as added at that time, removing a node removes its sub-tree,
+//        moving a node moves its sub-tree
+template<typename N, int I = 0>
+class QUaModelTraceRecorder
+{
+public:
+	explicit QUaModelTraceRecorder(QUaModel<N, I>* model);
+	QUaModelTraceRecorder(const QUaModelTraceRecorder&) = delete;
+	~QUaModelTraceRecorder();
+
+	bool start(const QString& fileName);
+	void stop();
+	bool isRecording() const;
+	quint64 recordCount() const;
+
+private:
+	// node type passed to model callbacks
+	typedef typename std::conditional<std::is_pointer<N>::value, N, N*>::type NodePtr;
+
+	QUaModel<N, I>* m_model;
+	QFile m_file;
+	QDataStream m_stream;
+	QElapsedTimer m_timer;
+	qint64 m_lastUsecs;
+	quint64 m_count;
+	quint32 m_nextId;
+	// NOTE : keyed by wrapper (index internal pointer), node is already
+	//        invalid by the time its rows are removed
+	QHash<void*, quint32> m_hashIds;
+	// ids of rows about to be moved, written once move is done
+	QList<quint32> m_listMoving;
+	QList<QMetaObject::Connection> m_connections;
+
+	void write(
+		const quint8& type, 
+		const quint32& id, 
+		const quint32& parentId = 0, 
+		const int& column = 0,
+		const int& row = 0
+	);
+	void addIndex(const QModelIndex& index);
+	void addRecursive(const QModelIndex& parent);
+	void forgetRecursive(const QModelIndex& index);
+};
+
+// reads a trace file recorded by QUaModelTraceRecorder
+class QUaModelTraceReader
+{
+public:
+	inline QUaModelTraceReader() : m_columnCount(0), m_timeUsecs(0) {};
+
+	inline bool open(const QString& fileName)
+	{
+		m_file.close();
+		m_file.setFileName(fileName);
+		m_columnCount = 0;
+		m_timeUsecs   = 0;
+		if (!m_file.open(QIODevice::ReadOnly))
+		{
+			return false;
+		}
+		m_stream.setDevice(&m_file);
+		m_stream.setVersion(QDataStream::Qt_5_0);
+		quint32 magic   = 0;
+		quint16 version = 0;
+		qint32  columnCount = 0;
+		m_stream >> magic >> version >> columnCount;
+		if (magic != QUaModelTraceMagic || version == 0 || version > QUaModelTraceVersion)
+		{
+			m_file.close();
+			return false;
+		}
+		m_columnCount = columnCount;
+		return true;
+	};
+	inline int columnCount() const
+	{
+		return m_columnCount;
+	};
+	inline bool atEnd() const
+	{
+		return !m_file.isOpen() || m_stream.atEnd();
+	};
+	inline bool readNext(QUaModelTraceRecord& record)
+	{
+		if (this->atEnd())
+		{
+			return false;
+		}
+		quint32 deltaUsecs = 0;
+		m_stream >> record.type >> deltaUsecs >> record.id;
+		record.parentId = 0;
+		record.column   = 0;
+		record.row      = 0;
+		if (record.type == QUaModelTraceRecord::Added)
+		{
+			m_stream >> record.parentId;
+		}
+		else if (record.type == QUaModelTraceRecord::Changed)
+		{
+			quint16 column = 0;
+			m_stream >> column;
+			record.column = column;
+		}
+		else if (record.type == QUaModelTraceRecord::Moved)
+		{
+			qint32 row = 0;
+			m_stream >> record.parentId >> row;
+			record.row = row;
+		}
+		m_timeUsecs += deltaUsecs;
+		record.timeUsecs = m_timeUsecs;
+		return m_stream.status() == QDataStream::Ok;
+	};
+private:
+	QFile m_file;
+	QDataStream m_stream;
+	int m_columnCount;
+	quint64 m_timeUsecs;
+};
+
+// feeds a trace into a model through user callbacks that create, delete 
+// and change nodes, so the model receives the same sequence of signals
+// NOTE : a frame is a batch of records followed by an event loop pass
+//        (coalesced inserts and updates are flushed, views repaint)
+class QUaModelTraceReplayer
+{
+public:
+	struct Report
+	{
+		quint64 records;
+		quint64 frames;
+		double  totalMs;
+		double  avgFrameMs;
+		double  maxFrameMs;
+		double  p99FrameMs;
+		double  recordsPerSecond;
+	};
+
+	inline QUaModelTraceReplayer() : m_realTime(false), m_maxRecordsPerFrame(256) {};
+
+	// wait for recorded time between records, else as fast as possible
+	inline void setRealTime(const bool& realTime)
+	{
+		m_realTime = realTime;
+	};
+	// only used if not real time
+	inline void setMaxRecordsPerFrame(const int& maxRecords)
+	{
+		m_maxRecordsPerFrame = qMax(1, maxRecords);
+	};
+
+	// create node with id as child of node with parentId (0 is root)
+	inline void setAddedCallback(const std::function<void(quint32, quint32)>& addedCallback)
+	{
+		m_addedCallback = addedCallback;
+	};
+	// delete node with id (and its sub-tree)
+	inline void setRemovedCallback(const std::function<void(quint32)>& removedCallback)
+	{
+		m_removedCallback = removedCallback;
+	};
+	// make node with id notify a change in column
+	inline void setChangedCallback(const std::function<void(quint32, int)>& changedCallback)
+	{
+		m_changedCallback = changedCallback;
+	};
+	// move node with id (and its sub-tree) under node with parentId at row
+	inline void setMovedCallback(const std::function<void(quint32, quint32, int)>& movedCallback)
+	{
+		m_movedCallback = movedCallback;
+	};
+	// delete all nodes
+	inline void setResetCallback(const std::function<void(void)>& resetCallback)
+	{
+		m_resetCallback = resetCallback;
+	};
+
+	inline Report replay(QUaModelTraceReader& reader)
+	{
+		QVector<qint64> frames;
+		quint64 records = 0;
+		QElapsedTimer clock;
+		clock.start();
+		QUaModelTraceRecord record;
+		bool hasRecord = reader.readNext(record);
+		while (hasRecord)
+		{
+			// wait until first record of frame is due
+			if (m_realTime)
+			{
+				qint64 waitUsecs = static_cast<qint64>(record.timeUsecs) - clock.nsecsElapsed() / 1000;
+				if (waitUsecs > 0)
+				{
+					QCoreApplication::processEvents();
+					QThread::usleep(static_cast<unsigned long>(qMin<qint64>(waitUsecs, 1000)));
+					continue;
+				}
+			}
+			QElapsedTimer frame;
+			frame.start();
+			int count = 0;
+			while (hasRecord)
+			{
+				if (m_realTime ?
+					static_cast<qint64>(record.timeUsecs) > clock.nsecsElapsed() / 1000 :
+					count >= m_maxRecordsPerFrame)
+				{
+					break;
+				}
+				this->apply(record);
+				count++;
+				hasRecord = reader.readNext(record);
+			}
+			QCoreApplication::processEvents();
+			frames << frame.nsecsElapsed();
+			records += static_cast<quint64>(count);
+		}
+		// report
+		Report report;
+		report.records    = records;
+		report.frames     = static_cast<quint64>(frames.count());
+		report.totalMs    = clock.nsecsElapsed() / 1e6;
+		report.avgFrameMs = 0;
+		report.maxFrameMs = 0;
+		report.p99FrameMs = 0;
+		report.recordsPerSecond = report.totalMs > 0 ? records / (report.totalMs / 1e3) : 0;
+		if (frames.isEmpty())
+		{
+			return report;
+		}
+		qint64 total = 0;
+		for (auto nsecs : frames)
+		{
+			total += nsecs;
+		}
+		std::sort(frames.begin(), frames.end());
+		report.avgFrameMs = total / 1e6 / frames.count();
+		report.maxFrameMs = frames.last() / 1e6;
+		report.p99FrameMs = frames.at((frames.count() - 1) * 99 / 100) / 1e6;
+		return report;
+	};
+
+private:
+	bool m_realTime;
+	int  m_maxRecordsPerFrame;
+	std::function<void(quint32, quint32)> m_addedCallback;
+	std::function<void(quint32)> m_removedCallback;
+	std::function<void(quint32, int)> m_changedCallback;
+	std::function<void(quint32, quint32, int)> m_movedCallback;
+	std::function<void(void)> m_resetCallback;
+
+	inline void apply(const QUaModelTraceRecord& record)
+	{
+		switch (record.type)
+		{
+		case QUaModelTraceRecord::Added:
+			if (m_addedCallback)
+			{
+				m_addedCallback(record.id, record.parentId);
+			}
+			break;
+		case QUaModelTraceRecord::Removed:
+			if (m_removedCallback)
+			{
+				m_removedCallback(record.id);
+			}
+			break;
+		case QUaModelTraceRecord::Changed:
+			if (m_changedCallback)
+			{
+				m_changedCallback(record.id, record.column);
+			}
+			break;
+		case QUaModelTraceRecord::Reset:
+			if (m_resetCallback)
+			{
+				m_resetCallback();
+			}
+			break;
+		case QUaModelTraceRecord::Moved:
+			if (m_movedCallback)
+			{
+				m_movedCallback(record.id, record.parentId, record.row);
+			}
+			break;
+		default:
+			Q_ASSERT(false);
+			break;
+		}
+	};
+};
+
+template<typename N, int I>
+inline QUaModelTraceRecorder<N, I>::QUaModelTraceRecorder(QUaModel<N, I>* model)
+	: m_model(model), m_lastUsecs(0), m_count(0), m_nextId(1)
+{
+	Q_CHECK_PTR(m_model);
+}
+
+template<typename N, int I>
+inline QUaModelTraceRecorder<N, I>::~QUaModelTraceRecorder()
+{
+	this->stop();
+}
+
+template<typename N, int I>
+inline bool QUaModelTraceRecorder<N, I>::start(const QString& fileName)
+{
+	this->stop();
+	m_file.setFileName(fileName);
+	if (!m_file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+	{
+		return false;
+	}
+	m_stream.setDevice(&m_file);
+	m_stream.setVersion(QDataStream::Qt_5_0);
+	m_stream << QUaModelTraceMagic << QUaModelTraceVersion 
+		<< static_cast<qint32>(m_model->columnCount());
+	m_count     = 0;
+	m_nextId    = 1;
+	m_lastUsecs = 0;
+	m_hashIds.clear();
+	m_timer.start();
+	// current content
+	this->addRecursive(QModelIndex());
+	// new nodes
+	m_connections << m_model->connectNodeAddedCallback(m_model,
+	[this](NodePtr, const QModelIndex& index) {
+		this->addIndex(index);
+	});
+	// removed nodes, whole sub-tree goes away
+	m_connections << QObject::connect(m_model, &QAbstractItemModel::rowsAboutToBeRemoved, m_model,
+	[this](const QModelIndex& parent, int first, int last) {
+		for (int row = first; row <= last; row++)
+		{
+			auto index = m_model->index(row, 0, parent);
+			quint32 id = m_hashIds.value(index.internalPointer(), 0);
+			if (!id)
+			{
+				continue;
+			}
+			this->write(QUaModelTraceRecord::Removed, id);
+			this->forgetRecursive(index);
+		}
+	});
+	// moved nodes, wrappers are relinked so ids are kept
+	m_connections << QObject::connect(m_model, &QAbstractItemModel::rowsAboutToBeMoved, m_model,
+	[this](const QModelIndex& parent, int first, int last) {
+		m_listMoving.clear();
+		for (int row = first; row <= last; row++)
+		{
+			auto index = m_model->index(row, 0, parent);
+			m_listMoving << m_hashIds.value(index.internalPointer(), 0);
+		}
+	});
+	m_connections << QObject::connect(m_model, &QAbstractItemModel::rowsMoved, m_model,
+	[this](const QModelIndex& parent, int first, int last, const QModelIndex& destination, int row) {
+		// NOTE : destination row is counted before the move
+		int newFirst = parent == destination && row > first ? row - (last - first + 1) : row;
+		quint32 parentId = destination.isValid() ? m_hashIds.value(destination.internalPointer(), 0) : 0;
+		for (int i = 0; i < m_listMoving.count(); i++)
+		{
+			quint32 id = m_listMoving.at(i);
+			if (!id)
+			{
+				continue;
+			}
+			this->write(QUaModelTraceRecord::Moved, id, parentId, 0, newFirst + i);
+		}
+		m_listMoving.clear();
+	});
+	// changed cells
+	m_connections << m_model->connectNodeChangedCallback(m_model,
+	[this](NodePtr, const QModelIndex& index) {
+		quint32 id = m_hashIds.value(index.internalPointer(), 0);
+		if (!id)
+		{
+			return;
+		}
+		this->write(QUaModelTraceRecord::Changed, id, 0, index.column());
+	});
+	// resets, content after reset recorded as added
+	m_connections << QObject::connect(m_model, &QAbstractItemModel::modelAboutToBeReset, m_model,
+	[this]() {
+		this->write(QUaModelTraceRecord::Reset, 0);
+		m_hashIds.clear();
+	});
+	m_connections << QObject::connect(m_model, &QAbstractItemModel::modelReset, m_model,
+	[this]() {
+		this->addRecursive(QModelIndex());
+	});
+	return true;
+}
+
+template<typename N, int I>
+inline void QUaModelTraceRecorder<N, I>::stop()
+{
+	for (auto& conn : m_connections)
+	{
+		QObject::disconnect(conn);
+	}
+	m_connections.clear();
+	m_hashIds.clear();
+	m_listMoving.clear();
+	if (m_file.isOpen())
+	{
+		m_file.close();
+	}
+}
+
+template<typename N, int I>
+inline bool QUaModelTraceRecorder<N, I>::isRecording() const
+{
+	return m_file.isOpen();
+}
+
+template<typename N, int I>
+inline quint64 QUaModelTraceRecorder<N, I>::recordCount() const
+{
+	return m_count;
+}
+
+template<typename N, int I>
+inline void QUaModelTraceRecorder<N, I>::write(
+	const quint8& type, 
+	const quint32& id, 
+	const quint32& parentId/* = 0*/, 
+	const int& column/* = 0*/,
+	const int& row/* = 0*/
+)
+{
+	qint64 usecs = m_timer.nsecsElapsed() / 1000;
+	quint32 deltaUsecs = static_cast<quint32>(qMin<qint64>(usecs - m_lastUsecs, 0xFFFFFFFF));
+	m_lastUsecs = usecs;
+	m_stream << type << deltaUsecs << id;
+	if (type == QUaModelTraceRecord::Added)
+	{
+		m_stream << parentId;
+	}
+	else if (type == QUaModelTraceRecord::Changed)
+	{
+		m_stream << static_cast<quint16>(column);
+	}
+	else if (type == QUaModelTraceRecord::Moved)
+	{
+		m_stream << parentId << static_cast<qint32>(row);
+	}
+	m_count++;
+}
+
+template<typename N, int I>
+inline void QUaModelTraceRecorder<N, I>::addIndex(const QModelIndex& index)
+{
+	// ignore already recorded (e.g. snapshot)
+	if (!index.isValid() || m_hashIds.contains(index.internalPointer()))
+	{
+		return;
+	}
+	QModelIndex parent = index.parent();
+	quint32 parentId = parent.isValid() ? m_hashIds.value(parent.internalPointer(), 0) : 0;
+	quint32 id = m_nextId++;
+	m_hashIds.insert(index.internalPointer(), id);
+	this->write(QUaModelTraceRecord::Added, id, parentId);
+}
+
+template<typename N, int I>
+inline void QUaModelTraceRecorder<N, I>::addRecursive(const QModelIndex& parent)
+{
+	int rows = m_model->rowCount(parent);
+	for (int row = 0; row < rows; row++)
+	{
+		auto index = m_model->index(row, 0, parent);
+		this->addIndex(index);
+		this->addRecursive(index);
+	}
+}
+
+template<typename N, int I>
+inline void QUaModelTraceRecorder<N, I>::forgetRecursive(const QModelIndex& index)
+{
+	m_hashIds.remove(index.internalPointer());
+	int rows = m_model->rowCount(index);
+	for (int row = 0; row < rows; row++)
+	{
+		this->forgetRecursive(m_model->index(row, 0, index));
+	}
+}
+
+#endif // QUAMODELTRACE_H
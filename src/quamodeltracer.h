@@ -0,0 +1,206 @@
+#ifndef QUAMODELTRACER_H
+#define QUAMODELTRACER_H
+
+#include <QVector>
+#include <QHash>
+#include <functional>
+#include <QFile>
+#include <QElapsedTimer>
+#include <QUaModelWatchdog>
+
+// collects Chrome trace events (open saved file in Perfetto or chrome://tracing)
+// of model and view activity, disabled by default
+// NOTE : events are buffered in memory and only written on save, names and 
+//        categories must be string literals, not thread safe (gui thread only)
+class QUaModelTracer
+{
+public:
+	inline static QUaModelTracer* instance()
+	{
+		static QUaModelTracer tracer;
+		return &tracer;
+	};
+	// NOTE : single branch when disabled
+	inline static bool isEnabled()
+	{
+		return QUaModelTracer::instance()->m_enabled;
+	};
+	inline void setEnabled(const bool& enabled)
+	{
+		if (m_enabled == enabled)
+		{
+			return;
+		}
+		m_enabled = enabled;
+		// NOTE : copy, a callback might remove itself
+		auto callbacks = m_enabledCallbacks;
+		for (auto& callback : callbacks)
+		{
+			callback(m_enabled);
+		}
+	};
+	// called with new state whenever tracer is enabled or disabled, so
+	// owner (e.g. a model) only connects its trace hooks while enabled
+	inline void addEnabledCallback(const void* owner, const std::function<void(const bool&)>& callback)
+	{
+		m_enabledCallbacks.insert(owner, callback);
+	};
+	inline void removeEnabledCallback(const void* owner)
+	{
+		m_enabledCallbacks.remove(owner);
+	};
+	// buffer is not grown beyond this, further events are dropped
+	inline int maxEvents() const
+	{
+		return m_maxEvents;
+	};
+	inline void setMaxEvents(const int& maxEvents)
+	{
+		m_maxEvents = qMax(0, maxEvents);
+	};
+	inline int eventCount() const
+	{
+		return m_events.count();
+	};
+	inline quint64 droppedCount() const
+	{
+		return m_dropped;
+	};
+	inline void clear()
+	{
+		m_events.clear();
+		m_dropped = 0;
+	};
+	// nanoseconds since tracer was created
+	inline qint64 now() const
+	{
+		return m_timer.nsecsElapsed();
+	};
+	// duration event (ph X)
+	inline void complete(const char* name, const char* category, const qint64& start, const qint64& end)
+	{
+		this->append(name, category, 'X', start, end - start);
+	};
+	// nested begin and end events (ph B and E), must match
+	inline void begin(const char* name, const char* category)
+	{
+		this->append(name, category, 'B', this->now(), 0);
+	};
+	inline void end(const char* name, const char* category)
+	{
+		this->append(name, category, 'E', this->now(), 0);
+	};
+	// instant event (ph i)
+	inline void instant(const char* name, const char* category)
+	{
+		this->append(name, category, 'i', this->now(), 0);
+	};
+	// write buffered events as Chrome trace-event JSON
+	inline bool save(const QString& fileName) const
+	{
+		QFile file(fileName);
+		if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+		{
+			return false;
+		}
+		file.write("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+		for (int i = 0; i < m_events.count(); i++)
+		{
+			auto& event = m_events.at(i);
+			QByteArray line = QByteArray("{\"name\":\"") + event.m_name +
+				"\",\"cat\":\"" + event.m_category +
+				"\",\"ph\":\"" + event.m_phase +
+				"\",\"ts\":" + QByteArray::number(event.m_start / 1000.0, 'f', 3);
+			if (event.m_phase == 'X')
+			{
+				line += ",\"dur\":" + QByteArray::number(event.m_duration / 1000.0, 'f', 3);
+			}
+			else if (event.m_phase == 'i')
+			{
+				line += ",\"s\":\"t\"";
+			}
+			line += ",\"pid\":1,\"tid\":1}";
+			line += i < m_events.count() - 1 ? ",\n" : "\n";
+			file.write(line);
+		}
+		file.write("]}\n");
+		return true;
+	};
+private:
+	inline QUaModelTracer() : m_enabled(false), m_maxEvents(1000000), m_dropped(0)
+	{
+		m_timer.start();
+	};
+	struct Event
+	{
+		const char* m_name;
+		const char* m_category;
+		qint64 m_start;
+		qint64 m_duration;
+		char m_phase;
+	};
+	bool m_enabled;
+	int  m_maxEvents;
+	quint64 m_dropped;
+	QElapsedTimer m_timer;
+	QVector<Event> m_events;
+	QHash<const void*, std::function<void(const bool&)>> m_enabledCallbacks;
+
+	inline void append(
+		const char* name, 
+		const char* category, 
+		const char& phase, 
+		const qint64& start, 
+		const qint64& duration
+	)
+	{
+		if (!m_enabled)
+		{
+			return;
+		}
+		if (m_events.count() >= m_maxEvents)
+		{
+			m_dropped++;
+			return;
+		}
+		Event event;
+		event.m_name     = name;
+		event.m_category = category;
+		event.m_phase    = phase;
+		event.m_start    = start;
+		event.m_duration = duration;
+		m_events.append(event);
+	};
+};
+
+// adds a duration event for the enclosing scope if tracer enabled
+// NOTE : also marks the scope as running operation for QUaModelWatchdog
+class QUaModelTracerScope
+{
+public:
+	inline QUaModelTracerScope(const char* name, const char* category)
+		: m_operation(name), m_name(name), m_category(category), m_start(-1)
+	{
+		if (QUaModelTracer::isEnabled())
+		{
+			m_start = QUaModelTracer::instance()->now();
+		}
+	};
+	QUaModelTracerScope(const QUaModelTracerScope&) = delete;
+	inline ~QUaModelTracerScope()
+	{
+		if (m_start < 0)
+		{
+			return;
+		}
+		auto tracer = QUaModelTracer::instance();
+		tracer->complete(m_name, m_category, m_start, tracer->now());
+	};
+private:
+	QUaModelOperationScope m_operation;
+	const char* m_name;
+	const char* m_category;
+	qint64 m_start;
+};
+
+#endif // QUAMODELTRACER_H
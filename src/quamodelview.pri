@@ -5,6 +5,9 @@ HEADERS += \
     $$PWD/quamodel.h \
     $$PWD/quatablemodel.h \
     $$PWD/quatreemodel.h \
+    $$PWD/quamodeltrace.h \
+    $$PWD/quamodeltracer.h \
+    $$PWD/quamodelwatchdog.h \
     $$PWD/quaview.h \
     $$PWD/quatableview.h \
     $$PWD/quatreeview.h
\ No newline at end of file
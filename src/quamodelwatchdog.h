@@ -0,0 +1,314 @@
+#ifndef QUAMODELWATCHDOG_H
+#define QUAMODELWATCHDOG_H
+
+#include <QObject>
+#include <QMetaType>
+#include <QDateTime>
+#include <QElapsedTimer>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+// stack of model operations and user callbacks running on the gui thread,
+// read by QUaModelWatchdog from its helper thread to attribute stalls
+// NOTE : names must be string literals, nesting deeper than MaxDepth is
+//        counted but not named
+class QUaModelOperation
+{
+public:
+	static const int MaxDepth = 16;
+	// snapshot of running operations, outermost first (thread safe)
+	inline static QList<QByteArray> current()
+	{
+		auto& stack = QUaModelOperation::stack();
+		int depth = qMin(stack.m_depth.load(std::memory_order_acquire), static_cast<int>(MaxDepth));
+		QList<QByteArray> operations;
+		for (int i = 0; i < depth; i++)
+		{
+			operations << QByteArray(stack.m_names[i].load(std::memory_order_relaxed));
+		}
+		return operations;
+	};
+	// NOTE : only call from the gui thread, use QUaModelOperationScope instead
+	inline static void push(const char* name)
+	{
+		auto& stack = QUaModelOperation::stack();
+		int depth = stack.m_depth.load(std::memory_order_relaxed);
+		if (depth < MaxDepth)
+		{
+			stack.m_names[depth].store(name, std::memory_order_relaxed);
+		}
+		stack.m_depth.store(depth + 1, std::memory_order_release);
+	};
+	inline static void pop()
+	{
+		auto& stack = QUaModelOperation::stack();
+		stack.m_depth.fetch_sub(1, std::memory_order_release);
+	};
+	// true while any QUaModelWatchdog is running, else stack is not kept
+	inline static bool isWatched()
+	{
+		return QUaModelOperation::watchers().load(std::memory_order_relaxed) > 0;
+	};
+private:
+	friend class QUaModelWatchdog;
+	struct Stack
+	{
+		inline Stack() : m_depth(0)
+		{
+			for (int i = 0; i < MaxDepth; i++)
+			{
+				m_names[i].store("", std::memory_order_relaxed);
+			}
+		};
+		std::atomic<int> m_depth;
+		// NOTE : pointers to string literals, always valid even if stale
+		std::atomic<const char*> m_names[MaxDepth];
+	};
+	inline static Stack& stack()
+	{
+		static Stack stack;
+		return stack;
+	};
+	// number of running watchdogs
+	inline static std::atomic<int>& watchers()
+	{
+		static std::atomic<int> watchers(0);
+		return watchers;
+	};
+};
+
+// marks the enclosing scope as a running model operation
+// NOTE : no-op unless a watchdog is running when the scope is entered
+class QUaModelOperationScope
+{
+public:
+	inline explicit QUaModelOperationScope(const char* name)
+		: m_pushed(QUaModelOperation::isWatched())
+	{
+		if (m_pushed)
+		{
+			QUaModelOperation::push(name);
+		}
+	};
+	QUaModelOperationScope(const QUaModelOperationScope&) = delete;
+	inline ~QUaModelOperationScope()
+	{
+		if (m_pushed)
+		{
+			QUaModelOperation::pop();
+		}
+	};
+private:
+	bool m_pushed;
+};
+
+struct QUaModelStall
+{
+	inline QUaModelStall() : msecs(0) {};
+	QDateTime timestamp;
+	qint64 msecs;
+	// operations running when stall crossed threshold, outermost first
+	QList<QByteArray> operations;
+
+	inline QByteArray message() const
+	{
+		QByteArray strMessage = "GUI thread stalled for " + QByteArray::number(msecs) + " ms";
+		if (operations.isEmpty())
+		{
+			return strMessage + " outside model operations.";
+		}
+		strMessage += " in ";
+		for (int i = 0; i < operations.count(); i++)
+		{
+			strMessage += (i > 0 ? " > " : "") + operations.at(i);
+		}
+		return strMessage + ".";
+	};
+};
+// NOTE : needed for queued and cross-thread connections to stalled
+Q_DECLARE_METATYPE(QUaModelStall)
+
+// measures gui event loop latency from a helper thread and reports stalls
+// attributed to the model operation or callback running at the time
+// NOTE : create and start on the gui thread, reports are delivered there
+class QUaModelWatchdog : public QObject
+{
+	Q_OBJECT
+public:
+	inline explicit QUaModelWatchdog(QObject* parent = nullptr)
+		: QObject(parent)
+	{
+		m_threshold = 500;
+		m_interval  = 100;
+		m_running   = false;
+		m_pending   = false;
+		m_captured  = false;
+		m_postedNsecs = 0;
+		m_stallCount  = 0;
+		m_timer.start();
+		qRegisterMetaType<QUaModelStall>("QUaModelStall");
+		QObject::connect(
+			this,
+			&QUaModelWatchdog::ping,
+			this,
+			&QUaModelWatchdog::on_ping,
+			Qt::QueuedConnection
+		);
+	};
+	inline ~QUaModelWatchdog()
+	{
+		this->stop();
+	};
+
+	// event loop latency in milliseconds considered a stall
+	inline int threshold() const
+	{
+		return m_threshold;
+	};
+	inline void setThreshold(const int& threshold)
+	{
+		m_threshold = qMax(1, threshold);
+	};
+	// milliseconds between helper thread checks
+	inline int interval() const
+	{
+		return m_interval;
+	};
+	inline void setInterval(const int& interval)
+	{
+		m_interval = qMax(1, interval);
+	};
+
+	inline bool isRunning() const
+	{
+		return m_running;
+	};
+	inline void start()
+	{
+		if (m_running)
+		{
+			return;
+		}
+		m_running = true;
+		m_pending = false;
+		QUaModelOperation::watchers().fetch_add(1, std::memory_order_relaxed);
+		m_thread  = std::thread([this]() {
+			this->watch();
+		});
+	};
+	inline void stop()
+	{
+		if (!m_running)
+		{
+			return;
+		}
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_running = false;
+		}
+		m_condition.notify_all();
+		m_thread.join();
+		QUaModelOperation::watchers().fetch_sub(1, std::memory_order_relaxed);
+	};
+
+	inline quint64 stallCount() const
+	{
+		return m_stallCount;
+	};
+	inline QUaModelStall lastStall() const
+	{
+		return m_lastStall;
+	};
+
+	// NOTE : message is meant for QUaLog (e.g. QUaLogWidget::addLog),
+	//        called on the gui thread after the stall ends
+	template <typename M = const std::function<void(const QByteArray&, const QDateTime&)>&>
+	inline void setLogCallback(M&& logCallback)
+	{
+		m_funcLog = logCallback;
+	};
+
+Q_SIGNALS:
+	void stalled(const QUaModelStall& stall);
+	// NOTE : emitted from helper thread, always queued to watchdog's thread
+	void ping(QPrivateSignal);
+
+private:
+	int m_threshold;
+	int m_interval;
+	std::atomic<bool> m_running;
+	std::thread m_thread;
+	std::mutex m_mutex;
+	std::condition_variable m_condition;
+	QElapsedTimer m_timer;
+	// state shared with helper thread, guarded by m_mutex
+	bool    m_pending;
+	bool    m_captured;
+	qint64  m_postedNsecs;
+	QList<QByteArray> m_operations;
+	// gui thread only
+	quint64 m_stallCount;
+	QUaModelStall m_lastStall;
+	std::function<void(const QByteArray&, const QDateTime&)> m_funcLog;
+
+	// helper thread
+	inline void watch()
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		while (m_running)
+		{
+			m_condition.wait_for(lock, std::chrono::milliseconds(m_interval));
+			if (!m_running)
+			{
+				break;
+			}
+			if (!m_pending)
+			{
+				m_pending     = true;
+				m_captured    = false;
+				m_postedNsecs = m_timer.nsecsElapsed();
+				// NOTE : stall might end before threshold is checked again
+				m_operations.clear();
+				emit this->ping(QPrivateSignal());
+				continue;
+			}
+			// NOTE : capture once, when the stall is first detected
+			qint64 msecs = (m_timer.nsecsElapsed() - m_postedNsecs) / 1000000;
+			if (m_captured || msecs < m_threshold)
+			{
+				continue;
+			}
+			m_captured   = true;
+			m_operations = QUaModelOperation::current();
+		}
+	};
+
+	// gui thread
+	inline void on_ping()
+	{
+		QUaModelStall stall;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_pending   = false;
+			stall.msecs = (m_timer.nsecsElapsed() - m_postedNsecs) / 1000000;
+			if (stall.msecs < m_threshold)
+			{
+				return;
+			}
+			stall.operations = m_operations;
+		}
+		stall.timestamp = QDateTime::currentDateTimeUtc();
+		m_stallCount++;
+		m_lastStall = stall;
+		emit this->stalled(stall);
+		if (m_funcLog)
+		{
+			m_funcLog(stall.message(), stall.timestamp);
+		}
+	};
+};
+
+#endif // QUAMODELWATCHDOG_H
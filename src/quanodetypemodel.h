@@ -21,6 +21,10 @@ public:
 
     void unbindAll();
 
+protected:
+    // adds type bindings
+    void addToMemoryReport(QUaModelMemoryReport& report) const override;
+
 private:
     
     QHash<QString, QMetaObject::Connection> m_connections;
@@ -42,6 +46,18 @@ inline QUaNodeTypeModel::~QUaNodeTypeModel()
     }
 }
 
+inline void QUaNodeTypeModel::addToMemoryReport(QUaModelMemoryReport& report) const
+{
+    quint64 bytes = QUaModelMemoryReport::hashBytes(m_connections) +
+        m_connections.count() * QUaModelMemoryReport::ConnectionBytes;
+    for (auto it = m_connections.constBegin(); it != m_connections.constEnd(); ++it)
+    {
+        bytes += QUaModelMemoryReport::stringBytes(it.key());
+    }
+    report.connections += m_connections.count();
+    report.bytes["types"] = bytes;
+}
+
 template<typename T>
 inline void QUaNodeTypeModel::bindType(QUaServer* server)
 {
@@ -101,17 +117,21 @@ inline void QUaNodeTypeModel::unbindType()
     QObject::disconnect(m_connections.take(strTypeName));
     // unbind existing children
     this->beginResetModel();
+    this->discardPendingUpdates();
     m_root->children().erase(
 	std::remove_if(m_root->children().begin(), m_root->children().end(),
 	[this, &strTypeName](QUaModel::QUaNodeWrapper * wrapper) {
         bool isOfType = strTypeName.compare(wrapper->node()->metaObject()->className(), Qt::CaseSensitive) == 0;
         if (isOfType)
         {
+            this->unindexNodes(wrapper);
             delete wrapper;
         }
         return isOfType;
 	}),
     m_root->children().end());
+    // remaining rows have shifted
+    this->reindexChildren(m_root);
     this->endResetModel();
 }
 
@@ -15,8 +15,12 @@ public:
 
     void addNode(N node);
 
+    // NOTE : rows are inserted as a single range, one notification
     void addNodes(const QList<N> &nodes);
 
+	// thread safe, node is added later in model's thread (see QUaModel::postRemoveNode)
+	void postAddNode(N node);
+
 	template<typename X = N>
 	typename std::enable_if<std::is_pointer<X>::value, bool>::type
     removeNode(N node);
@@ -25,10 +29,24 @@ public:
 	typename std::enable_if<!std::is_pointer<X>::value, bool>::type
 	removeNode(N * node);
 
+	// NOTE : rows are removed in contiguous ranges, one notification per range
+	template<typename X = N>
+	typename std::enable_if<std::is_pointer<X>::value, int>::type
+	removeNodes(const QList<N>& nodes);
+
+	template<typename X = N>
+	typename std::enable_if<!std::is_pointer<X>::value, int>::type
+	removeNodes(const QList<N*>& nodes);
+
 	int count();
 
 protected:
-    
+	// posted inserts are appended as a single range
+	void applyPostedInserts(const QList<N>& nodes) override;
+
+private:
+	// bind change and destroy callbacks of new wrapper
+	void bindWrapper(typename QUaModel<N, I>::QUaNodeWrapper* wrapper);
 };
 
 template<typename N, int I>
@@ -54,7 +72,7 @@ template<typename N, int I>
 inline void QUaTableModel<N, I>::addNode(N node)
 {
     //Q_ASSERT(!QUaModel<N, I>::m_root->childByNode(node));
-    QModelIndex index = QUaModel<N, I>::m_root->index();
+    QModelIndex index = this->indexFromWrapper(QUaModel<N, I>::m_root);
 	// get new node's row
     int row = QUaModel<N, I>::m_root->children().count();
 	// notify views that row will be added
@@ -63,41 +81,15 @@ inline void QUaTableModel<N, I>::addNode(N node)
     auto* wrapper = new typename QUaModel<N, I>::QUaNodeWrapper(node, QUaModel<N, I>::m_root, false);
 	// apprend to parent's children list
     QUaModel<N, I>::m_root->children() << wrapper;
-	// bind callback for data change on each column
-	this->bindChangeCallbackForAllColumns(wrapper, false);
-	// subscribe to instance removed
-	auto conn = QUaModelItemTraits::DestroyCallback<N, I>(wrapper->node(),
-        [this, wrapper]() {
-			Q_CHECK_PTR(wrapper);
-            auto root =
-        #ifdef Q_OS_LINUX
-                    QUaModel<N, I>::
-        #endif
-                    m_root;
-            Q_ASSERT(root);
-			Q_UNUSED(root);
-			// remove
-			this->removeWrapper(wrapper);
-        }
-	);
-	if (conn)
-	{
-		// NOTE : QUaNodeWrapper destructor removes connections
-		wrapper->connections() << conn;
-	}
+	// store new row, no other rows are affected
+    this->reindexChildren(QUaModel<N, I>::m_root, row);
+    this->indexNodes(wrapper, false);
+	// bind callbacks
+	this->bindWrapper(wrapper);
 	// notify views that row addition has finished
 	this->endInsertRows();
-	// force index creation (indirectly)
-	// because sometimes they are not created until a view requires them
-	// and if a child is added and parent's index is not ready then crash
-    bool indexOk = this->checkIndexRecursive(
-		this->index(row, 0, index)
-#if QT_VERSION >= QT_VERSION_CHECK(5, 11, 0)
-		, QAbstractItemModel::CheckIndexOption::IndexIsValid
-#endif
-	);
-	Q_ASSERT(indexOk);
-	Q_UNUSED(indexOk);
+	// debug only
+    this->debugCheckIndex(this->indexFromWrapper(wrapper));
 	// emit added signal
 	this->handleNodeAddedRecursive(wrapper);
 }
@@ -105,10 +97,97 @@ inline void QUaTableModel<N, I>::addNode(N node)
 template<typename N, int I>
 inline void QUaTableModel<N, I>::addNodes(const QList<N>& nodes)
 {
+	if (nodes.isEmpty())
+	{
+		return;
+	}
+    QModelIndex index = this->indexFromWrapper(QUaModel<N, I>::m_root);
+	// get new nodes' rows
+    int first = QUaModel<N, I>::m_root->children().count();
+	int last  = first + nodes.count() - 1;
+	// notify views that rows will be added
+	this->beginInsertRows(index, first, last);
+	QList<typename QUaModel<N, I>::QUaNodeWrapper*> listNew;
 	for (auto node : nodes)
 	{
-        this->addNode(node);
-    }
+		auto* wrapper = new typename QUaModel<N, I>::QUaNodeWrapper(node, QUaModel<N, I>::m_root, false);
+		QUaModel<N, I>::m_root->children() << wrapper;
+		this->indexNodes(wrapper, false);
+		this->bindWrapper(wrapper);
+		listNew << wrapper;
+	}
+	// store new rows, no other rows are affected
+    this->reindexChildren(QUaModel<N, I>::m_root, first);
+	// notify views that rows addition has finished
+	this->endInsertRows();
+	// debug only
+    this->debugCheckIndex(index, true);
+	// emit added signals
+	// NOTE : handlers might remove rows (e.g. to enforce a max count), 
+	//        so skip new wrappers no longer in node index, hashes are 
+	//        taken now because removed wrappers are freed
+	QList<uint> listHashes;
+	for (auto wrapper : listNew)
+	{
+		listHashes << wrapper->hash();
+	}
+	for (int i = 0; i < listNew.count(); i++)
+	{
+		auto wrapper = listNew.at(i);
+		if (!this->isWrapperIndexed(wrapper, listHashes.at(i)))
+		{
+			continue;
+		}
+		this->handleNodeAddedRecursive(wrapper);
+	}
+}
+
+template<typename N, int I>
+inline void QUaTableModel<N, I>::postAddNode(N node)
+{
+	typename QUaModel<N, I>::Mutation mutation;
+	mutation.m_type   = QUaModel<N, I>::MutationType::Insert;
+	mutation.m_node   = node;
+	mutation.m_column = -1;
+	this->postMutation(mutation);
+}
+
+template<typename N, int I>
+inline void QUaTableModel<N, I>::applyPostedInserts(const QList<N>& nodes)
+{
+	this->addNodes(nodes);
+}
+
+template<typename N, int I>
+inline void QUaTableModel<N, I>::bindWrapper(typename QUaModel<N, I>::QUaNodeWrapper* wrapper)
+{
+	// bind callback for data change on each column
+	this->bindChangeCallbackForAllColumns(wrapper, false);
+	// subscribe to instance removed
+	QMetaObject::Connection conn;
+	{
+		QUaModelStatsTimer timer(this->statsTraitCalls(), this->statsTraitNsecs(), "DestroyCallback");
+		conn = QUaModelItemTraits::DestroyCallback<N, I>(wrapper->node(),
+		[this, wrapper]() {
+			Q_CHECK_PTR(wrapper);
+			auto root =
+		#ifdef Q_OS_LINUX
+				QUaModel<N, I>::
+		#endif
+				m_root;
+			Q_ASSERT(root);
+			Q_UNUSED(root);
+			// detach so wrapper no longer points to node, then remove right away
+			this->detachWrapper(wrapper);
+			this->removeWrapper(wrapper);
+		}
+		);
+	}
+	if (conn)
+	{
+		// NOTE : QUaNodeWrapper destructor removes connections
+		wrapper->connections() << conn;
+	}
 }
 
 template<typename N, int I>
@@ -123,13 +202,14 @@ inline
 typename std::enable_if<std::is_pointer<X>::value, bool>::type 
 	QUaTableModel<N, I>::removeNode(N node)
 {
-	auto wrapper = QUaModel<N, I>::m_root->childByNode(node);
-	if (!wrapper)
+	// NOTE : hashed lookup, no search
+	auto wrappers = this->wrappersFromNode(node);
+	if (wrappers.isEmpty())
 	{
 		return false;
 	}
 	// NOTE : QUaNodeWrapper destructor removes connections
-	this->removeWrapper(wrapper);
+	this->removeWrapper(wrappers.first());
 	return true;
 }
 
@@ -139,14 +219,74 @@ inline
 typename std::enable_if<!std::is_pointer<X>::value, bool>::type
 QUaTableModel<N, I>::removeNode(N* node)
 {
-	auto wrapper = QUaModel<N, I>::m_root->childByNode(node);
-	if (!wrapper)
+	// NOTE : hashed lookup, no search, but index matches by content 
+	//        (IsEqual) so pick the wrapper of this instance
+	for (auto wrapper : this->wrappersFromNode(node))
 	{
-		return false;
+		if (wrapper->node() != node)
+		{
+			continue;
+		}
+		// NOTE : QUaNodeWrapper destructor removes connections
+		this->removeWrapper(wrapper);
+		return true;
+	}
+	return false;
+}
+
+template<typename N, int I>
+template<typename X>
+inline
+typename std::enable_if<std::is_pointer<X>::value, int>::type
+QUaTableModel<N, I>::removeNodes(const QList<N>& nodes)
+{
+	QList<typename QUaModel<N, I>::QUaNodeWrapper*> wrappers;
+	QSet<typename QUaModel<N, I>::QUaNodeWrapper*> setWrappers;
+	for (auto node : nodes)
+	{
+		// NOTE : a node listed twice removes two of its rows, if any
+		for (auto wrapper : this->wrappersFromNode(node))
+		{
+			if (setWrappers.contains(wrapper))
+			{
+				continue;
+			}
+			setWrappers.insert(wrapper);
+			wrappers << wrapper;
+			break;
+		}
 	}
 	// NOTE : QUaNodeWrapper destructor removes connections
-	this->removeWrapper(wrapper);
-	return true;
+	this->removeWrappers(wrappers);
+	return wrappers.count();
+}
+
+template<typename N, int I>
+template<typename X>
+inline
+typename std::enable_if<!std::is_pointer<X>::value, int>::type
+QUaTableModel<N, I>::removeNodes(const QList<N*>& nodes)
+{
+	QList<typename QUaModel<N, I>::QUaNodeWrapper*> wrappers;
+	QSet<typename QUaModel<N, I>::QUaNodeWrapper*> setWrappers;
+	for (auto node : nodes)
+	{
+		// NOTE : index matches by content (IsEqual), so content-equal nodes
+		//        share candidates, only remove the wrapper of this instance
+		for (auto wrapper : this->wrappersFromNode(node))
+		{
+			if (wrapper->node() != node || setWrappers.contains(wrapper))
+			{
+				continue;
+			}
+			setWrappers.insert(wrapper);
+			wrappers << wrapper;
+			break;
+		}
+	}
+	// NOTE : QUaNodeWrapper destructor removes connections
+	this->removeWrappers(wrappers);
+	return wrappers.count();
 }
 
 #endif // QUATABLEMODEL_H
@@ -28,6 +28,9 @@ public:
 
 	// overwrite to handle keyboard events
 	void keyPressEvent(QKeyEvent* event) override;
+
+	// overwrite to trace paint passes
+	void paintEvent(QPaintEvent* event) override;
 };
 
 template<typename N, int I>
@@ -68,4 +71,11 @@ inline void QUaTableView<N, I>::keyPressEvent(QKeyEvent* event)
         ::template keyPressEvent<QTableView>(event);
 }
 
+template<typename N, int I>
+inline void QUaTableView<N, I>::paintEvent(QPaintEvent* event)
+{
+	QUaView<QUaTableView, N, I>
+        ::template paintEvent<QTableView>(event);
+}
+
 #endif // QUATABLEVIEW_H
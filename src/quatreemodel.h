@@ -13,20 +13,188 @@ public:
     N    rootNode() const;
     void setRootNode(N rootNode = nullptr);
 
+    // multi-root mode, each added node (and its sub-tree) is a top-level row,
+    // roots are inserted and removed with row notifications, no reset
+    // NOTE : first addRootNode resets the model if a root node was set
+    template<typename X = N>
+    typename std::enable_if<std::is_pointer<X>::value, bool>::type
+    addRootNode(N rootNode);
+    template<typename X = N>
+    typename std::enable_if<std::is_pointer<X>::value, bool>::type
+    removeRootNode(N rootNode);
+    // top-level nodes in multi-root mode, empty otherwise
+    QList<N> rootNodes() const;
+    bool isMultiRoot() const;
+
+    void clear() override;
+
+    // if true, children of a node are only wrapped (and subscribed to) 
+    // when a view expands it, applies on next setRootNode
+    bool lazyPopulation() const;
+    void setLazyPopulation(const bool& lazyPopulation);
+
+    // if true, setRootNode only publishes the first level and the rest of
+    // the tree is fetched level by level in time slices when the event loop 
+    // is idle, applies on next setRootNode
+    bool incrementalPopulation() const;
+    void setIncrementalPopulation(const bool& incrementalPopulation);
+    // max milliseconds spent fetching per event loop iteration
+    int  populationSlice() const;
+    void setPopulationSlice(const int& populationSlice);
+    // nodes failing the filter never get a wrapper, nor do their descendants,
+    // so unlike proxy filtering they cost nothing, applies on next setRootNode
+    template<typename X = N, typename M = const std::function<bool(N)>&>
+    typename std::enable_if<std::is_pointer<X>::value, void>::type
+    setBindFilter(M bindFilter);
+    void clearBindFilter();
+    // max depth of wrapped nodes (root's children are depth 1), 0 means 
+    // no limit, applies on next setRootNode
+    int  maxDepth() const;
+    void setMaxDepth(const int& maxDepth);
+
+    // true while there are wrappers left to fetch
+    bool isPopulating() const;
+    // stop fetching, unfetched nodes are still fetched when a view expands them
+    void cancelPopulation();
+    // called after each time slice with number of nodes published so far 
+    // and number of nodes waiting to be fetched, pending is 0 when done
+    template<typename M = const std::function<void(int, int)>&>
+    QMetaObject::Connection connectPopulationProgressCallback(
+        const QObject* context,
+        M populationProgressCallback,
+        Qt::ConnectionType type = Qt::AutoConnection
+    );
+
+    // Qt optional API:
+    bool hasChildren(const QModelIndex& parent = QModelIndex()) const override;
+    bool canFetchMore(const QModelIndex& parent) const override;
+    void fetchMore(const QModelIndex& parent) override;
+    bool removeRows(int row, int count, const QModelIndex& parent = QModelIndex()) override;
+
+protected:
+    // adds pending inserts
+    void addToMemoryReport(QUaModelMemoryReport& report) const override;
+    // calls processPendingInserts
+    void flushPendingInserts() override;
+
 private:
+    // NOTE : children added to the same parent within one event loop pass
+    //        are buffered here and inserted later as a single contiguous range
+    QHash<
+        typename QUaModel<N, I>::QUaNodeWrapper*,
+        QList<typename QUaModel<N, I>::QUaNodeWrapper*>
+    > m_hashPendingInserts;
+    QList<typename QUaModel<N, I>::QUaNodeWrapper*> m_listPendingParents;
+    bool m_insertsScheduled;
+    bool m_lazyPopulation;
+    bool m_multiRoot;
+    // NOTE : queued wrappers are unfetched leaves of the wrapper tree, set is
+    //        used to skip the ones removed while queued
+    QQueue<typename QUaModel<N, I>::QUaNodeWrapper*> m_queuePopulation;
+    QSet<typename QUaModel<N, I>::QUaNodeWrapper*> m_setPopulation;
+    bool m_incrementalPopulation;
+    bool m_populationActive;
+    bool m_populationScheduled;
+    int  m_populationSlice;
+    int  m_populationCount;
+    std::function<bool(N)> m_bindFilter;
+    int  m_maxDepth;
+
+    // number of ancestors of wrapper, 0 for root
+    int  depth(typename QUaModel<N, I>::QUaNodeWrapper* wrapper) const;
+    // true if wrapper's children would be deeper than max depth
+    bool isMaxDepth(typename QUaModel<N, I>::QUaNodeWrapper* wrapper) const;
+    // children of wrapper's node that pass bind filter and max depth
+    QList<N> bindableChildren(typename QUaModel<N, I>::QUaNodeWrapper* wrapper) const;
+    // build wrapper's sub-tree, only with bindable children
+    void buildWrapper(typename QUaModel<N, I>::QUaNodeWrapper* wrapper);
+
     void bindRoot(typename QUaModel<N, I>::QUaNodeWrapper* root);
     void bindRecursivelly(typename QUaModel<N, I>::QUaNodeWrapper* wrapper);
+    // NOTE : only for fetched wrappers, new children of unfetched wrappers 
+    //        are picked up when fetched
+    void bindNewChild(typename QUaModel<N, I>::QUaNodeWrapper* wrapper);
+    // NOTE : only for unfetched wrappers cached as childless, updates cache
+    //        when a bindable child is added (see hasChildren)
+    void bindHasChildren(typename QUaModel<N, I>::QUaNodeWrapper* wrapper) const;
+    // subscribe to node moved (see QUaModelItemTraits::MoveCallback)
+    template<typename X = N>
+    typename std::enable_if<std::is_pointer<X>::value, void>::type
+    bindMove(typename QUaModel<N, I>::QUaNodeWrapper* wrapper);
+    template<typename X = N>
+    typename std::enable_if<!std::is_pointer<X>::value, void>::type
+    bindMove(typename QUaModel<N, I>::QUaNodeWrapper* wrapper);
+    // relink existing sub-tree under new parent, nullptr if not in model
+    void moveWrapper(
+        typename QUaModel<N, I>::QUaNodeWrapper* wrapper,
+        typename QUaModel<N, I>::QUaNodeWrapper* newParent,
+        const int& row
+    );
+    // new unbuilt wrapper for the same node, used to rebuild a sub-tree
+    template<typename X = N>
+    typename std::enable_if<std::is_pointer<X>::value, typename QUaModel<N, I>::QUaNodeWrapper*>::type
+    copyWrapper(
+        typename QUaModel<N, I>::QUaNodeWrapper* wrapper,
+        typename QUaModel<N, I>::QUaNodeWrapper* parent
+    );
+    template<typename X = N>
+    typename std::enable_if<!std::is_pointer<X>::value, typename QUaModel<N, I>::QUaNodeWrapper*>::type
+    copyWrapper(
+        typename QUaModel<N, I>::QUaNodeWrapper* wrapper,
+        typename QUaModel<N, I>::QUaNodeWrapper* parent
+    );
+    // build, insert at row, bind and publish a new wrapper
+    void insertWrapper(
+        typename QUaModel<N, I>::QUaNodeWrapper* parent,
+        typename QUaModel<N, I>::QUaNodeWrapper* wrapper,
+        const int& row
+    );
+    // wrap children of an unfetched wrapper and publish them to views
+    void fetchWrapper(
+        typename QUaModel<N, I>::QUaNodeWrapper* wrapper,
+        const QModelIndex& index
+    );
+
+    void queuePopulation(typename QUaModel<N, I>::QUaNodeWrapper* wrapper);
+    void unqueuePopulation(const QModelIndex& parent, int first, int last);
+    void processPopulation();
+
+    void queueInsert(
+        typename QUaModel<N, I>::QUaNodeWrapper* parent,
+        typename QUaModel<N, I>::QUaNodeWrapper* child
+    );
+    void processPendingInserts();
+    void discardPendingInserts();
 };
 
 template<class N, int I>
 inline QUaTreeModel<N, I>::QUaTreeModel(QObject* parent)
     : QUaModel<N, I>(parent)
 {
+    m_insertsScheduled      = false;
+    m_lazyPopulation        = false;
+    m_multiRoot             = false;
+    m_incrementalPopulation = false;
+    m_populationActive      = false;
+    m_populationScheduled   = false;
+    m_populationSlice       = 8;
+    m_populationCount       = 0;
+    m_maxDepth              = 0;
+    // forget queued wrappers about to be deleted
+    QObject::connect(this, &QAbstractItemModel::rowsAboutToBeRemoved, this,
+    [this](const QModelIndex& parent, int first, int last) {
+        this->unqueuePopulation(parent, first, last);
+    });
+    QObject::connect(this, &QAbstractItemModel::modelAboutToBeReset, this,
+    [this]() {
+        this->cancelPopulation();
+    });
 }
 
 template<class N, int I>
 inline QUaTreeModel<N, I>::~QUaTreeModel()
 {
+    this->discardPendingInserts();
     if (QUaModel<N, I>::m_root)
     {
         delete QUaModel<N, I>::m_root;
@@ -43,7 +211,501 @@ inline N QUaTreeModel<N, I>::rootNode() const
 template<class N, int I>
 inline void QUaTreeModel<N, I>::setRootNode(N rootNode)
 {
-    this->bindRoot(new typename QUaModel<N, I>::QUaNodeWrapper(rootNode));
+    m_multiRoot = false;
+    auto root = new typename QUaModel<N, I>::QUaNodeWrapper(rootNode, nullptr, false);
+    if (!m_lazyPopulation && !m_incrementalPopulation)
+    {
+        this->buildWrapper(root);
+        this->bindRoot(root);
+        return;
+    }
+    // only wrap first level, deeper levels are fetched on demand
+    root->buildChildren(this->bindableChildren(root), false);
+    this->bindRoot(root);
+    if (!m_incrementalPopulation)
+    {
+        return;
+    }
+    // NOTE : reset in bindRoot cancelled any previous population, with
+    //        nothing to queue it is done already and stays inactive
+    if (root->children().isEmpty())
+    {
+        emit QUaModel<N, I>::m_eventer.populationProgress(0, 0);
+        return;
+    }
+    m_populationActive = true;
+    m_populationCount  = root->children().count();
+    for (auto child : root->children())
+    {
+        this->queuePopulation(child);
+    }
+}
+
+template<class N, int I>
+inline bool QUaTreeModel<N, I>::lazyPopulation() const
+{
+    return m_lazyPopulation;
+}
+
+template<class N, int I>
+inline void QUaTreeModel<N, I>::setLazyPopulation(const bool& lazyPopulation)
+{
+    m_lazyPopulation = lazyPopulation;
+}
+
+template<class N, int I>
+template<typename X>
+inline typename std::enable_if<std::is_pointer<X>::value, bool>::type
+QUaTreeModel<N, I>::addRootNode(N rootNode)
+{
+    if (!QUaModelItemTraits::IsValid<N, I>(rootNode))
+    {
+        return false;
+    }
+    // NOTE : in multi-root mode the root wrapper has an invalid node, same 
+    //        as after setRootNode(nullptr), so only switching mode resets
+    if (!m_multiRoot)
+    {
+        this->setRootNode(QUaModelItemTraits::GetInvalid<N, I>());
+        m_multiRoot = true;
+    }
+    auto root = QUaModel<N, I>::m_root;
+    Q_CHECK_PTR(root);
+    if (root->childByNode(rootNode))
+    {
+        return false;
+    }
+    // rows must be up to date before inserting
+    this->processPendingInserts();
+    auto wrapper = new typename QUaModel<N, I>::QUaNodeWrapper(rootNode, root, false);
+    // NOTE : if lazy or incremental, children are fetched later
+    if (!m_lazyPopulation && !m_incrementalPopulation)
+    {
+        this->buildWrapper(wrapper);
+    }
+    int row = root->children().count();
+    // notify views that row will be added
+    this->beginInsertRows(QModelIndex(), row, row);
+    root->children() << wrapper;
+    // store rows of new sub-tree
+    this->reindexChildren(root, row);
+    this->reindexChildrenRecursive(wrapper);
+    this->indexNodes(wrapper);
+    // bind new sub-tree for changes
+    this->bindRecursivelly(wrapper);
+    // notify views that row addition has finished
+    this->endInsertRows();
+    // debug only
+    this->debugCheckIndex(this->indexFromWrapper(wrapper));
+    // emit added signal
+    this->handleNodeAddedRecursive(wrapper);
+    if (m_populationActive)
+    {
+        m_populationCount++;
+        this->queuePopulation(wrapper);
+    }
+    return true;
+}
+
+template<class N, int I>
+template<typename X>
+inline typename std::enable_if<std::is_pointer<X>::value, bool>::type
+QUaTreeModel<N, I>::removeRootNode(N rootNode)
+{
+    auto root = QUaModel<N, I>::m_root;
+    if (!m_multiRoot || !root)
+    {
+        return false;
+    }
+    // rows must be up to date before removing
+    this->processPendingInserts();
+    auto wrapper = root->childByNode(rootNode);
+    if (!wrapper)
+    {
+        return false;
+    }
+    // NOTE : QUaNodeWrapper destructor removes connections
+    this->removeWrapper(wrapper);
+    return true;
+}
+
+template<class N, int I>
+inline QList<N> QUaTreeModel<N, I>::rootNodes() const
+{
+    QList<N> rootNodes;
+    auto root = QUaModel<N, I>::m_root;
+    if (!m_multiRoot || !root)
+    {
+        return rootNodes;
+    }
+    for (auto wrapper : root->children())
+    {
+        // ignore destroyed, removal is pending
+        if (!QUaModelItemTraits::IsValid<N, I>(wrapper->node()))
+        {
+            continue;
+        }
+        rootNodes << wrapper->node();
+    }
+    return rootNodes;
+}
+
+template<class N, int I>
+inline bool QUaTreeModel<N, I>::isMultiRoot() const
+{
+    return m_multiRoot;
+}
+
+template<class N, int I>
+template<typename X, typename M>
+inline typename std::enable_if<std::is_pointer<X>::value, void>::type
+QUaTreeModel<N, I>::setBindFilter(M bindFilter)
+{
+    m_bindFilter = [bindFilter](N node) {
+        return bindFilter(node);
+    };
+}
+
+template<class N, int I>
+inline void QUaTreeModel<N, I>::clearBindFilter()
+{
+    m_bindFilter = nullptr;
+}
+
+template<class N, int I>
+inline int QUaTreeModel<N, I>::maxDepth() const
+{
+    return m_maxDepth;
+}
+
+template<class N, int I>
+inline void QUaTreeModel<N, I>::setMaxDepth(const int& maxDepth)
+{
+    m_maxDepth = qMax(0, maxDepth);
+}
+
+template<class N, int I>
+inline int QUaTreeModel<N, I>::depth(
+    typename QUaModel<N, I>::QUaNodeWrapper* wrapper
+) const
+{
+    int depth = 0;
+    for (auto ancestor = wrapper->parent(); ancestor; ancestor = ancestor->parent())
+    {
+        depth++;
+    }
+    return depth;
+}
+
+template<class N, int I>
+inline bool QUaTreeModel<N, I>::isMaxDepth(
+    typename QUaModel<N, I>::QUaNodeWrapper* wrapper
+) const
+{
+    return m_maxDepth > 0 && this->depth(wrapper) >= m_maxDepth;
+}
+
+template<class N, int I>
+inline QList<N> QUaTreeModel<N, I>::bindableChildren(
+    typename QUaModel<N, I>::QUaNodeWrapper* wrapper
+) const
+{
+    if (this->isMaxDepth(wrapper))
+    {
+        return QList<N>();
+    }
+    QList<N> children;
+    {
+        QUaModelStatsTimer timer(this->statsTraitCalls(), this->statsTraitNsecs(), "GetChildren");
+        children = QUaModelItemTraits::GetChildren<N, I>(wrapper->node());
+    }
+    if (!m_bindFilter)
+    {
+        return children;
+    }
+    QList<N> listBindable;
+    listBindable.reserve(children.count());
+    for (auto& child : children)
+    {
+        if (m_bindFilter(child))
+        {
+            listBindable << child;
+        }
+    }
+    return listBindable;
+}
+
+template<class N, int I>
+inline void QUaTreeModel<N, I>::buildWrapper(
+    typename QUaModel<N, I>::QUaNodeWrapper* wrapper
+)
+{
+    // NOTE : iterative breadth first instead of wrapper's recursive build, 
+    //        so bind filter and max depth apply to every level
+    QList<typename QUaModel<N, I>::QUaNodeWrapper*> wrappers;
+    wrappers << wrapper;
+    for (int i = 0; i < wrappers.count(); i++)
+    {
+        auto current = wrappers.at(i);
+        current->buildChildren(this->bindableChildren(current), false);
+        wrappers << current->children();
+    }
+}
+
+template<class N, int I>
+inline bool QUaTreeModel<N, I>::incrementalPopulation() const
+{
+    return m_incrementalPopulation;
+}
+
+template<class N, int I>
+inline void QUaTreeModel<N, I>::setIncrementalPopulation(const bool& incrementalPopulation)
+{
+    m_incrementalPopulation = incrementalPopulation;
+}
+
+template<class N, int I>
+inline int QUaTreeModel<N, I>::populationSlice() const
+{
+    return m_populationSlice;
+}
+
+template<class N, int I>
+inline void QUaTreeModel<N, I>::setPopulationSlice(const int& populationSlice)
+{
+    m_populationSlice = qMax(1, populationSlice);
+}
+
+template<class N, int I>
+inline bool QUaTreeModel<N, I>::isPopulating() const
+{
+    return !m_setPopulation.isEmpty();
+}
+
+template<class N, int I>
+inline void QUaTreeModel<N, I>::cancelPopulation()
+{
+    m_populationActive = false;
+    m_queuePopulation.clear();
+    m_setPopulation.clear();
+}
+
+template<class N, int I>
+template<typename M>
+inline QMetaObject::Connection QUaTreeModel<N, I>::connectPopulationProgressCallback(
+    const QObject* context,
+    M populationProgressCallback,
+    Qt::ConnectionType type/* = Qt::AutoConnection*/
+)
+{
+    return QObject::connect(&(QUaModel<N, I>::m_eventer), &QUaModelBaseEventer::populationProgress, context,
+    [populationProgressCallback](int populated, int pending) {
+        populationProgressCallback(populated, pending);
+    }, type);
+}
+
+template<class N, int I>
+inline bool QUaTreeModel<N, I>::hasChildren(const QModelIndex& parent) const
+{
+    auto root = QUaModel<N, I>::m_root;
+    if (!root || parent.column() > 0)
+    {
+        return false;
+    }
+    auto wrapper = parent.isValid() ?
+        static_cast<typename QUaModel<N, I>::QUaNodeWrapper*>(parent.internalPointer()) :
+        root;
+    Q_CHECK_PTR(wrapper);
+    if (wrapper->isFetched())
+    {
+        return !wrapper->children().isEmpty();
+    }
+    // NOTE : ask node without creating wrappers, so view can show expander,
+    //        only once per wrapper, views call this on every paint
+    if (wrapper->isHasChildrenCached())
+    {
+        return wrapper->cachedHasChildren();
+    }
+    if (!this->isWrapperValid(wrapper))
+    {
+        return false;
+    }
+    bool hasChildren = !this->bindableChildren(wrapper).isEmpty();
+    wrapper->setCachedHasChildren(hasChildren);
+    // a child added later invalidates a negative answer, a positive one can
+    // only go stale on removal, then fetch just finds no rows
+    if (!hasChildren && !this->isMaxDepth(wrapper))
+    {
+        this->bindHasChildren(wrapper);
+    }
+    return hasChildren;
+}
+
+template<class N, int I>
+inline bool QUaTreeModel<N, I>::canFetchMore(const QModelIndex& parent) const
+{
+    auto root = QUaModel<N, I>::m_root;
+    if (!root || parent.column() > 0)
+    {
+        return false;
+    }
+    auto wrapper = parent.isValid() ?
+        static_cast<typename QUaModel<N, I>::QUaNodeWrapper*>(parent.internalPointer()) :
+        root;
+    Q_CHECK_PTR(wrapper);
+    return !wrapper->isFetched() && this->isWrapperValid(wrapper);
+}
+
+template<class N, int I>
+inline void QUaTreeModel<N, I>::fetchMore(const QModelIndex& parent)
+{
+    if (!this->canFetchMore(parent))
+    {
+        return;
+    }
+    auto wrapper = parent.isValid() ?
+        static_cast<typename QUaModel<N, I>::QUaNodeWrapper*>(parent.internalPointer()) :
+        QUaModel<N, I>::m_root;
+    this->fetchWrapper(wrapper, parent);
+}
+
+template<class N, int I>
+inline void QUaTreeModel<N, I>::fetchWrapper(
+    typename QUaModel<N, I>::QUaNodeWrapper* wrapper,
+    const QModelIndex& parent
+)
+{
+    // get children first to know the number of rows
+    QList<N> children = this->bindableChildren(wrapper);
+    if (children.isEmpty())
+    {
+        wrapper->buildChildren(children, false);
+        this->bindNewChild(wrapper);
+        return;
+    }
+    // notify views that rows will be added
+    this->beginInsertRows(parent, 0, children.count() - 1);
+    // NOTE : not recursive, grandchildren are fetched on demand
+    wrapper->buildChildren(children, false);
+    // store new rows
+    this->reindexChildren(wrapper);
+    for (auto childWrapper : wrapper->children())
+    {
+        this->indexNodes(childWrapper, false);
+    }
+    // bind new instances for changes, and parent for new children
+    for (auto childWrapper : wrapper->children())
+    {
+        this->bindRecursivelly(childWrapper);
+    }
+    this->bindNewChild(wrapper);
+    // notify views that rows addition has finished
+    this->endInsertRows();
+    // emit added signal
+    for (auto childWrapper : wrapper->children())
+    {
+        this->handleNodeAddedRecursive(childWrapper);
+    }
+    // NOTE : also if fetched by a view, so population continues below
+    if (!m_populationActive)
+    {
+        return;
+    }
+    m_populationCount += wrapper->children().count();
+    for (auto childWrapper : wrapper->children())
+    {
+        this->queuePopulation(childWrapper);
+    }
+}
+
+template<class N, int I>
+inline void QUaTreeModel<N, I>::queuePopulation(
+    typename QUaModel<N, I>::QUaNodeWrapper* wrapper
+)
+{
+    Q_ASSERT(m_populationActive && !wrapper->isFetched());
+    m_queuePopulation.enqueue(wrapper);
+    m_setPopulation.insert(wrapper);
+    if (m_populationScheduled)
+    {
+        return;
+    }
+    m_populationScheduled = true;
+    // NOTE : idle, so user interaction and data updates go first
+    this->execLater([this]() {
+        this->processPopulation();
+    }, QUaModelBaseEventer::Priority::Idle);
+}
+
+template<class N, int I>
+inline void QUaTreeModel<N, I>::unqueuePopulation(const QModelIndex& parent, int first, int last)
+{
+    if (m_setPopulation.isEmpty())
+    {
+        return;
+    }
+    auto wrapper = parent.isValid() ?
+        static_cast<typename QUaModel<N, I>::QUaNodeWrapper*>(parent.internalPointer()) :
+        QUaModel<N, I>::m_root;
+    Q_CHECK_PTR(wrapper);
+    QList<typename QUaModel<N, I>::QUaNodeWrapper*> wrappers = wrapper->children().mid(first, last - first + 1);
+    for (int i = 0; i < wrappers.count(); i++)
+    {
+        auto current = wrappers.at(i);
+        wrappers << current->children();
+        // NOTE : stale queue entries are skipped when dequeued
+        m_setPopulation.remove(current);
+    }
+}
+
+template<class N, int I>
+inline void QUaTreeModel<N, I>::processPopulation()
+{
+    m_populationScheduled = false;
+    if (!m_populationActive)
+    {
+        return;
+    }
+    QUaModelTracerScope scope("populate", "model");
+    QElapsedTimer timer;
+    timer.start();
+    // NOTE : breadth first, so views get one level at a time
+    while (!m_queuePopulation.isEmpty() && timer.elapsed() < m_populationSlice)
+    {
+        auto wrapper = m_queuePopulation.dequeue();
+        // ignore removed while queued and fetched by a view meanwhile
+        if (!m_setPopulation.remove(wrapper) || wrapper->isFetched())
+        {
+            continue;
+        }
+        if (!QUaModelItemTraits::IsValid<N, I>(wrapper->node()))
+        {
+            continue;
+        }
+        this->fetchWrapper(wrapper, this->indexFromWrapper(wrapper));
+    }
+    if (m_setPopulation.isEmpty())
+    {
+        // NOTE : done, nodes added from now on are built right away
+        m_populationActive = false;
+        m_queuePopulation.clear();
+    }
+    else if (!m_populationScheduled)
+    {
+        m_populationScheduled = true;
+        this->execLater([this]() {
+            this->processPopulation();
+        }, QUaModelBaseEventer::Priority::Idle);
+    }
+    emit QUaModel<N, I>::m_eventer.populationProgress(m_populationCount, m_setPopulation.count());
+}
+
+template<class N, int I>
+inline void QUaTreeModel<N, I>::clear()
+{
+    // pending wrappers might belong to the sub-trees about to be deleted
+    this->discardPendingInserts();
+    QUaModel<N, I>::clear();
 }
 
 template<class N, int I>
@@ -55,8 +717,12 @@ inline void QUaTreeModel<N, I>::bindRoot(
     {
         return;
     }
+    // pending wrappers might belong to the old tree
+    this->discardPendingInserts();
     // notify views all old data is invalid
     this->beginResetModel();
+    this->discardPendingUpdates();
+    this->unindexNodes();
     // if old root node was valid, disconnect to recv signals recursivelly
     if (QUaModel<N, I>::m_root)
     {
@@ -65,6 +731,12 @@ inline void QUaTreeModel<N, I>::bindRoot(
     }
     // copy
     QUaModel<N, I>::m_root = root;
+    // store rows of whole tree once, then only updated incrementally
+    if (QUaModel<N, I>::m_root)
+    {
+        this->reindexChildrenRecursive(QUaModel<N, I>::m_root);
+        this->indexNodes(QUaModel<N, I>::m_root);
+    }
     // subscribe to changes
     this->bindRecursivelly(QUaModel<N, I>::m_root);
     // notify views new data is available
@@ -76,98 +748,474 @@ inline void QUaTreeModel<N, I>::bindRecursivelly(
     typename QUaModel<N, I>::QUaNodeWrapper* wrapper
 )
 {
+    QUaModelTracerScope scope("bindRecursivelly", "model");
     // subscribe to node removed
-    auto conn = QUaModelItemTraits::DestroyCallback<N, I>(wrapper->node(),
-        static_cast<std::function<void(void)>>([this, wrapper]() {
-        Q_CHECK_PTR(wrapper);
-        auto root = QUaModel<N, I>::m_root;
-        if (wrapper == root)
-        {
-            this->setRootNode(QUaModelItemTraits::GetInvalid<N, I>());
-            return;
-        }
-        // NOTE : node->m_parent must be valid because (node == m_root) 
-        //        already handled
-        auto parent = wrapper->parent();
-        Q_ASSERT(parent);
-        // only use indexes created by model
-        int row = wrapper->index().row();
-        QModelIndex index = parent->index();
-        Q_ASSERT(parent == root ||
-            this->checkIndex(index, QAbstractItemModel::CheckIndexOption::IndexIsValid));
-        // notify views that row will be removed
-        this->beginRemoveRows(index, row, row);
-        // remove from parent, destructor deletes wrapper sub-tree recursivelly
-        Q_ASSERT(wrapper == parent->children().at(row));
-        delete parent->children().takeAt(row);
-        // notify views that row removal has finished
-        this->endRemoveRows();
-        // force index re-creation (indirectly)
-        // so we can delete multiple rows in a loop inmediatly (without having to queue them)
-        bool indexOk = this->checkIndexRecursive(
-            index,
-            QAbstractItemModel::CheckIndexOption::IndexIsValid,
-            parent == root
-        );
-        Q_ASSERT(indexOk);
-        Q_UNUSED(indexOk);
-    }));
+    QMetaObject::Connection conn;
+    {
+        QUaModelStatsTimer timer(this->statsTraitCalls(), this->statsTraitNsecs(), "DestroyCallback");
+        conn = QUaModelItemTraits::DestroyCallback<N, I>(wrapper->node(),
+            static_cast<std::function<void(void)>>([this, wrapper]() {
+            Q_CHECK_PTR(wrapper);
+            auto root = QUaModel<N, I>::m_root;
+            if (wrapper == root)
+            {
+                this->setRootNode(QUaModelItemTraits::GetInvalid<N, I>());
+                return;
+            }
+            // publish buffered inserts first, so no pending wrapper
+            // is left pointing to the sub-tree about to be deleted
+            this->processPendingInserts();
+            // NOTE : node->m_parent must be valid because (node == m_root) 
+            //        already handled
+            Q_ASSERT(wrapper->parent());
+            // detach sub-tree so destroyed signals of descendants are ignored,
+            // then remove it right away with a single row removal
+            this->detachWrapper(wrapper);
+            this->removeWrapper(wrapper);
+        }));
+    }
     // NOTE : QUaNodeWrapper destructor removes connections
     if (conn)
     {
         wrapper->connections() << conn;
     }
+    // subscribe to node moved, root cannot be moved
+    if (wrapper->parent())
+    {
+        this->bindMove(wrapper);
+    }
     // subscribe to new child node added
-    conn = QUaModelItemTraits::NewChildCallback<N, I>(wrapper->node(),
-        static_cast<std::function<void(N)>>([this, wrapper](N childNode) {
-            // TODO : implement a mechanism similar to QUaModelBaseEventer::execLater
-            //        to make all inserts requested in a single event loop call
-            //        at the same time and not one by one because now takes up to 
-            //        30% cpu time in a large > 10k deserialization test
-        // get new node's row
-        int row = wrapper->children().count();
+    if (wrapper->isFetched())
+    {
+        this->bindNewChild(wrapper);
+    }
+    // bind callback for data change on each column
+    this->bindChangeCallbackForAllColumns(wrapper, false);
+    // recurse children
+    for (auto child : wrapper->children())
+    {
+        this->bindRecursivelly(child);
+    }
+}
+
+template<class N, int I>
+inline void QUaTreeModel<N, I>::bindNewChild(
+    typename QUaModel<N, I>::QUaNodeWrapper* wrapper
+)
+{
+    Q_ASSERT(wrapper->isFetched());
+    // children would be deeper than allowed
+    if (this->isMaxDepth(wrapper))
+    {
+        return;
+    }
+    QMetaObject::Connection conn;
+    {
+        QUaModelStatsTimer timer(this->statsTraitCalls(), this->statsTraitNsecs(), "NewChildCallback");
+        conn = QUaModelItemTraits::NewChildCallback<N, I>(wrapper->node(),
+            static_cast<std::function<void(N)>>([this, wrapper](N childNode) {
+            // nodes that fail the filter never get a wrapper
+            if (m_bindFilter && !m_bindFilter(childNode))
+            {
+                return;
+            }
+            // create new wrapper, but do not build its children yet
+            // NOTE : wrapper subscribes to node destruction, so if node is deleted 
+            //        before being inserted, the wrapper's node will be invalid
+            auto* childWrapper = new typename QUaModel<N, I>::QUaNodeWrapper(
+                childNode, wrapper, false
+            );
+            // buffer, insert all children of this parent at once later
+            this->queueInsert(wrapper, childWrapper);
+        }));
+    }
+    // NOTE : QUaNodeWrapper destructor removes connections
+    if (conn)
+    {
+        wrapper->connections() << conn;
+    }
+}
+
+template<class N, int I>
+inline void QUaTreeModel<N, I>::bindHasChildren(
+    typename QUaModel<N, I>::QUaNodeWrapper* wrapper
+) const
+{
+    Q_ASSERT(!wrapper->isFetched());
+    QMetaObject::Connection conn;
+    {
+        QUaModelStatsTimer timer(this->statsTraitCalls(), this->statsTraitNsecs(), "NewChildCallback");
+        conn = QUaModelItemTraits::NewChildCallback<N, I>(wrapper->node(),
+            static_cast<std::function<void(N)>>([this, wrapper](N childNode) {
+            if (m_bindFilter && !m_bindFilter(childNode))
+            {
+                return;
+            }
+            wrapper->setCachedHasChildren(true);
+        }));
+    }
+    // NOTE : QUaNodeWrapper destructor removes connections
+    if (conn)
+    {
+        wrapper->connections() << conn;
+    }
+}
+
+template<class N, int I>
+template<typename X>
+inline typename std::enable_if<std::is_pointer<X>::value, void>::type
+QUaTreeModel<N, I>::bindMove(
+    typename QUaModel<N, I>::QUaNodeWrapper* wrapper
+)
+{
+    QMetaObject::Connection conn;
+    {
+        QUaModelStatsTimer timer(this->statsTraitCalls(), this->statsTraitNsecs(), "MoveCallback");
+        conn = QUaModelItemTraits::MoveCallback<N, I>(wrapper->node(),
+            static_cast<std::function<void(N, int)>>([this, wrapper](N parentNode, int row) {
+            // NOTE : check before root, in multi-root mode root's node is invalid
+            if (!QUaModelItemTraits::IsValid<N, I>(parentNode))
+            {
+                this->moveWrapper(wrapper, nullptr, row);
+                return;
+            }
+            auto root = QUaModel<N, I>::m_root;
+            // NOTE : root is not in node index
+            if (QUaModelItemTraits::IsEqual<N, I>(root->node(), parentNode))
+            {
+                this->moveWrapper(wrapper, root, row);
+                return;
+            }
+            auto wrappers = this->wrappersFromNode(parentNode);
+            this->moveWrapper(wrapper, wrappers.isEmpty() ? nullptr : wrappers.first(), row);
+        }));
+    }
+    // NOTE : QUaNodeWrapper destructor removes connections
+    if (conn)
+    {
+        wrapper->connections() << conn;
+    }
+}
+
+template<class N, int I>
+template<typename X>
+inline typename std::enable_if<!std::is_pointer<X>::value, void>::type
+QUaTreeModel<N, I>::bindMove(
+    typename QUaModel<N, I>::QUaNodeWrapper* wrapper
+)
+{
+    QMetaObject::Connection conn;
+    {
+        QUaModelStatsTimer timer(this->statsTraitCalls(), this->statsTraitNsecs(), "MoveCallback");
+        conn = QUaModelItemTraits::MoveCallback<N, I>(wrapper->node(),
+            static_cast<std::function<void(N&, int)>>([this, wrapper](N& parentNode, int row) {
+            // NOTE : check before root, in multi-root mode root's node is invalid
+            if (!QUaModelItemTraits::IsValid<N, I>(&parentNode))
+            {
+                this->moveWrapper(wrapper, nullptr, row);
+                return;
+            }
+            auto root = QUaModel<N, I>::m_root;
+            // NOTE : root is not in node index
+            if (QUaModelItemTraits::IsEqual<N, I>(root->node(), &parentNode))
+            {
+                this->moveWrapper(wrapper, root, row);
+                return;
+            }
+            auto wrappers = this->wrappersFromNode(&parentNode);
+            this->moveWrapper(wrapper, wrappers.isEmpty() ? nullptr : wrappers.first(), row);
+        }));
+    }
+    // NOTE : QUaNodeWrapper destructor removes connections
+    if (conn)
+    {
+        wrapper->connections() << conn;
+    }
+}
+
+template<class N, int I>
+inline void QUaTreeModel<N, I>::moveWrapper(
+    typename QUaModel<N, I>::QUaNodeWrapper* wrapper,
+    typename QUaModel<N, I>::QUaNodeWrapper* newParent,
+    const int& row
+)
+{
+    QUaModelTracerScope scope("moveWrapper", "model");
+    // rows must be up to date before moving
+    this->processPendingInserts();
+    auto oldParent = wrapper->parent();
+    Q_CHECK_PTR(oldParent);
+    // moved out of model, under a parent not fetched yet (fetched later 
+    // together with its other children) or deeper than max depth
+    if (!newParent || !newParent->isFetched() || this->isMaxDepth(newParent))
+    {
+        // NOTE : QUaNodeWrapper destructor removes connections
+        this->removeWrapper(wrapper);
+        return;
+    }
+    // a node cannot be moved into its own sub-tree
+    for (auto ancestor = newParent; ancestor; ancestor = ancestor->parent())
+    {
+        if (ancestor == wrapper)
+        {
+            Q_ASSERT_X(false, "QUaTreeModel::moveWrapper", "Node moved into its own sub-tree.");
+            return;
+        }
+    }
+    int oldRow = wrapper->row();
+    Q_ASSERT(oldParent->children().at(oldRow) == wrapper);
+    // new row after wrapper was taken from old parent
+    int count  = newParent->children().count() - (newParent == oldParent ? 1 : 0);
+    int newRow = row < 0 || row > count ? count : row;
+    // NOTE : with max depth the sub-tree's shape depends on its depth, so 
+    //        if it changes the sub-tree is removed and built again under 
+    //        new parent, which wraps and binds down to the new limit
+    if (m_maxDepth > 0 && this->depth(newParent) != this->depth(oldParent))
+    {
+        auto newWrapper = this->copyWrapper(wrapper, newParent);
+        // NOTE : QUaNodeWrapper destructor removes connections
+        this->removeWrapper(wrapper);
+        this->insertWrapper(newParent, newWrapper, newRow);
+        return;
+    }
+    if (newParent == oldParent && newRow == oldRow)
+    {
+        return;
+    }
+    // NOTE : destination of beginMoveRows is a row before the move
+    int destinationRow = newParent == oldParent && newRow > oldRow ? newRow + 1 : newRow;
+    // only use indexes created by model
+    QModelIndex oldIndex = this->indexFromWrapper(oldParent);
+    QModelIndex newIndex = this->indexFromWrapper(newParent);
+    // notify views that row will be moved
+    if (!this->beginMoveRows(oldIndex, oldRow, oldRow, newIndex, destinationRow))
+    {
+        return;
+    }
+    // relink, no wrapper in sub-tree is created, bound or deleted
+    oldParent->children().removeAt(oldRow);
+    newParent->children().insert(newRow, wrapper);
+    wrapper->setParent(newParent);
+    // shift rows of the siblings after the changed ones
+    if (newParent == oldParent)
+    {
+        this->reindexChildren(oldParent, qMin(oldRow, newRow));
+    }
+    else
+    {
+        this->reindexChildren(oldParent, oldRow);
+        this->reindexChildren(newParent, newRow);
+    }
+    // notify views that row move has finished
+    this->endMoveRows();
+    // debug only
+    // NOTE : new parent might have been a sibling after the moved row
+    auto root = QUaModel<N, I>::m_root;
+    this->debugCheckIndex(this->indexFromWrapper(oldParent), oldParent == root);
+    this->debugCheckIndex(this->indexFromWrapper(newParent), newParent == root);
+}
+
+template<class N, int I>
+template<typename X>
+inline typename std::enable_if<std::is_pointer<X>::value, typename QUaModel<N, I>::QUaNodeWrapper*>::type
+QUaTreeModel<N, I>::copyWrapper(
+    typename QUaModel<N, I>::QUaNodeWrapper* wrapper,
+    typename QUaModel<N, I>::QUaNodeWrapper* parent
+)
+{
+    return new typename QUaModel<N, I>::QUaNodeWrapper(wrapper->node(), parent, false);
+}
+
+template<class N, int I>
+template<typename X>
+inline typename std::enable_if<!std::is_pointer<X>::value, typename QUaModel<N, I>::QUaNodeWrapper*>::type
+QUaTreeModel<N, I>::copyWrapper(
+    typename QUaModel<N, I>::QUaNodeWrapper* wrapper,
+    typename QUaModel<N, I>::QUaNodeWrapper* parent
+)
+{
+    return new typename QUaModel<N, I>::QUaNodeWrapper(*wrapper->node(), parent, false);
+}
+
+template<class N, int I>
+inline void QUaTreeModel<N, I>::insertWrapper(
+    typename QUaModel<N, I>::QUaNodeWrapper* parent,
+    typename QUaModel<N, I>::QUaNodeWrapper* wrapper,
+    const int& row
+)
+{
+    Q_ASSERT(row >= 0 && row <= parent->children().count());
+    // NOTE : if lazy or incremental, children are fetched later
+    if (!m_lazyPopulation && !m_populationActive)
+    {
+        this->buildWrapper(wrapper);
+    }
+    // notify views that row will be added
+    this->beginInsertRows(this->indexFromWrapper(parent), row, row);
+    parent->children().insert(row, wrapper);
+    // store rows of new sub-tree and of the siblings after it
+    this->reindexChildren(parent, row);
+    this->reindexChildrenRecursive(wrapper);
+    this->indexNodes(wrapper);
+    // bind new sub-tree for changes
+    this->bindRecursivelly(wrapper);
+    // notify views that row addition has finished
+    this->endInsertRows();
+    // debug only
+    this->debugCheckIndex(this->indexFromWrapper(wrapper));
+    // emit added signal
+    this->handleNodeAddedRecursive(wrapper);
+    if (m_populationActive)
+    {
+        m_populationCount++;
+        this->queuePopulation(wrapper);
+    }
+}
+
+template<class N, int I>
+inline void QUaTreeModel<N, I>::queueInsert(
+    typename QUaModel<N, I>::QUaNodeWrapper* parent,
+    typename QUaModel<N, I>::QUaNodeWrapper* child
+)
+{
+    if (!m_hashPendingInserts.contains(parent))
+    {
+        m_listPendingParents << parent;
+    }
+    m_hashPendingInserts[parent] << child;
+    if (m_insertsScheduled)
+    {
+        return;
+    }
+    m_insertsScheduled = true;
+    // process all inserts requested in this event loop call at once
+    this->execLater([this]() {
+        this->processPendingInserts();
+    }, QUaModelBaseEventer::Priority::Structural);
+}
+
+template<class N, int I>
+inline bool QUaTreeModel<N, I>::removeRows(int row, int count, const QModelIndex& parent)
+{
+    // rows must be up to date before removing ranges
+    this->processPendingInserts();
+    return QUaModel<N, I>::removeRows(row, count, parent);
+}
+
+template<class N, int I>
+inline void QUaTreeModel<N, I>::processPendingInserts()
+{
+    m_insertsScheduled = false;
+    // take pending, new ones might be queued while processing
+    auto hashPending = m_hashPendingInserts;
+    auto listParents = m_listPendingParents;
+    m_hashPendingInserts.clear();
+    m_listPendingParents.clear();
+    auto root = QUaModel<N, I>::m_root;
+    for (auto wrapper : listParents)
+    {
+        Q_ASSERT(hashPending.contains(wrapper));
+        auto listNew = hashPending.take(wrapper);
+        // ignore nodes deleted before they could be inserted,
+        // and all children of a parent that is being deleted
+        bool parentValid = wrapper == root ||
+            QUaModelItemTraits::IsValid<N, I>(wrapper->node());
+        auto itInvalid = std::remove_if(listNew.begin(), listNew.end(),
+        [parentValid](typename QUaModel<N, I>::QUaNodeWrapper* childWrapper) {
+            return !parentValid ||
+                !QUaModelItemTraits::IsValid<N, I>(childWrapper->node());
+        });
+        for (auto it = itInvalid; it != listNew.end(); ++it)
+        {
+            delete *it;
+        }
+        listNew.erase(itInvalid, listNew.end());
+        if (listNew.isEmpty())
+        {
+            continue;
+        }
+        // get new nodes' rows
+        int first = wrapper->children().count();
+        int last  = first + listNew.count() - 1;
         // only use indexes created by model
-        QModelIndex index = wrapper->index();
-        auto root = QUaModel<N, I>::m_root;
+        QModelIndex index = this->indexFromWrapper(wrapper);
         Q_ASSERT(wrapper == root ||
             this->checkIndex(index, QAbstractItemModel::CheckIndexOption::IndexIsValid));
-        Q_UNUSED(root);
-        // notify views that row will be added
-        this->beginInsertRows(index, row, row);
-        // create new wrapper
-        auto* childWrapper = new typename QUaModel<N, I>::QUaNodeWrapper(
-            childNode, wrapper
-        );
-        // apprend to parent's children list
-        wrapper->children() << childWrapper;
-        // bind new instance for changes
-        this->bindRecursivelly(childWrapper);
-        // notify views that row addition has finished
+        // notify views that rows will be added
+        this->beginInsertRows(index, first, last);
+        for (auto childWrapper : listNew)
+        {
+            // build sub-tree now, includes grandchildren added while pending
+            // NOTE : if lazy, grandchildren are fetched on demand, if 
+            //        incremental, they are fetched in the next time slices
+            if (!m_lazyPopulation && !m_populationActive)
+            {
+                this->buildWrapper(childWrapper);
+            }
+            // apprend to parent's children list
+            wrapper->children() << childWrapper;
+            // store rows of new sub-tree
+            this->reindexChildrenRecursive(childWrapper);
+            this->indexNodes(childWrapper);
+            // bind new instance for changes
+            this->bindRecursivelly(childWrapper);
+        }
+        // store new rows, no other rows are affected
+        this->reindexChildren(wrapper, first);
+        // notify views that rows addition has finished
         this->endInsertRows();
-        // force index creation (indirectly)
-        // because sometimes they are not created until a view requires them
-        // and if a child is added and parent's index is not ready then crash
-        bool indexOk = this->checkIndexRecursive(
-            this->index(row, 0, index),
-            QAbstractItemModel::CheckIndexOption::IndexIsValid
-        );
-        Q_ASSERT(indexOk);
-        Q_UNUSED(indexOk);
+        // debug only
+        for (int row = first; row <= last; row++)
+        {
+            this->debugCheckIndex(this->indexFromWrapper(wrapper->children().at(row)));
+        }
         // emit added signal
-        this->handleNodeAddedRecursive(childWrapper);
-    }));
-    // NOTE : QUaNodeWrapper destructor removes connections
-    if (conn)
+        for (auto childWrapper : listNew)
+        {
+            this->handleNodeAddedRecursive(childWrapper);
+        }
+        if (!m_populationActive)
+        {
+            continue;
+        }
+        m_populationCount += listNew.count();
+        for (auto childWrapper : listNew)
+        {
+            this->queuePopulation(childWrapper);
+        }
+    }
+}
+
+template<class N, int I>
+inline void QUaTreeModel<N, I>::addToMemoryReport(QUaModelMemoryReport& report) const
+{
+    // NOTE : pending wrappers are not reachable from root yet
+    quint64 bytes = QUaModelMemoryReport::hashBytes(m_hashPendingInserts) +
+        QUaModelMemoryReport::listBytes(m_listPendingParents);
+    for (auto& children : m_hashPendingInserts)
     {
-        wrapper->connections() << conn;
+        bytes += QUaModelMemoryReport::listBytes(children) + static_cast<quint64>(children.count()) *
+            QUaModel<N, I>::QUaNodeWrapperPool::blockSize();
     }
-    // bind callback for data change on each column
-    this->bindChangeCallbackForAllColumns(wrapper);
-    // recurse children
-    for (auto child : wrapper->children())
+    report.bytes["pendingInserts"] = bytes;
+}
+
+template<class N, int I>
+inline void QUaTreeModel<N, I>::flushPendingInserts()
+{
+    this->processPendingInserts();
+}
+
+template<class N, int I>
+inline void QUaTreeModel<N, I>::discardPendingInserts()
+{
+    // NOTE : wrappers were not inserted yet, so views know nothing about them
+    for (auto listNew : m_hashPendingInserts)
     {
-        this->bindRecursivelly(child);
+        qDeleteAll(listNew);
     }
+    m_hashPendingInserts.clear();
+    m_listPendingParents.clear();
 }
 
 #endif // QUATREEMODEL_H
@@ -29,6 +29,9 @@ public:
 
 	// overwrite to handle keyboard events
 	void keyPressEvent(QKeyEvent* event) override;
+
+	// overwrite to trace paint passes
+	void paintEvent(QPaintEvent* event) override;
 	
 };
 
@@ -73,5 +76,12 @@ inline void QUaTreeView<N, I>::keyPressEvent(QKeyEvent* event)
         ::template keyPressEvent<QTreeView>(event);
 }
 
+template<typename N, int I>
+inline void QUaTreeView<N, I>::paintEvent(QPaintEvent* event)
+{
+	QUaView<QUaTreeView, N, I>
+        ::template paintEvent<QTreeView>(event);
+}
+
 #endif // QUATREEVIEW_H
 
@@ -7,6 +7,7 @@
 #include <QClipboard>
 #include <QMimeData>
 #include <QKeyEvent>
+#include <QPainter>
 #include <QUaModel>
 
 // SFINAE on members
@@ -277,6 +278,14 @@ public:
 	void clearCopyCallback();
 	void clearPasteCallback();
 
+	// debug overlay with the model's memory report (see QUaModelMemoryReport)
+	bool memoryOverlay() const;
+	void setMemoryOverlay(const bool& visible);
+	// NOTE : by default the overlay shows the view's model report, 
+	//        owners with extra storage (e.g. QUaLogWidget) can provide their own
+	template <typename M = const std::function<QUaModelMemoryReport()>&>
+	void setMemoryReportCallback(M&& memoryReportCallback);
+
 	// Inheirted class - Qt API:
 
 	// overwrite to ignore some calls to improve performance
@@ -291,8 +300,14 @@ public:
 	template <typename B>
 	void keyPressEvent(QKeyEvent* event);
 
+	// overwrite to trace paint passes (see QUaModelTracer)
+	template <typename B>
+	void paintEvent(QPaintEvent* event);
+
 protected:
 	T* m_thiz;
+	bool m_memoryOverlay;
+	std::function<QUaModelMemoryReport()> m_funcMemoryReport;
 
 	// internal delegate
 	class QUaItemDelegate : public QStyledItemDelegate
@@ -335,6 +350,7 @@ inline QUaView<T, N, I>::QUaView()
 #endif
 	m_proxy = nullptr;
 	m_thiz  = static_cast<T*>(this);
+	m_memoryOverlay = false;
 	m_thiz->setItemDelegate(new QUaView<T, N, I>::QUaItemDelegate(m_thiz));
 	m_thiz->setAlternatingRowColors(true);
 #ifdef Q_OS_LINUX
@@ -347,6 +363,27 @@ inline QUaView<T, N, I>::QUaView()
 	m_funcHandlePaste = nullptr;
 }
 
+template<typename T, typename N, int I>
+inline bool QUaView<T, N, I>::memoryOverlay() const
+{
+	return m_memoryOverlay;
+}
+
+template<typename T, typename N, int I>
+inline void QUaView<T, N, I>::setMemoryOverlay(const bool& visible)
+{
+	m_memoryOverlay = visible;
+	m_thiz->viewport()->update();
+}
+
+template<typename T, typename N, int I>
+template<typename M>
+inline void QUaView<T, N, I>::setMemoryReportCallback(M&& memoryReportCallback)
+{
+	m_funcMemoryReport = memoryReportCallback;
+	m_thiz->viewport()->update();
+}
+
 template<typename T, typename N, int I>
 template<typename B>
 inline void QUaView<T, N, I>::setModel(QAbstractItemModel* model)
@@ -448,19 +485,65 @@ inline void QUaView<T, N, I>::dataChanged(
 	const QModelIndex& bottomRight,
 	const QVector<int>& roles)
 {
-	// NOTE : QUaModel always emits dataChanged with (topLeft == bottomRight)
-	Q_ASSERT(topLeft == bottomRight);
+	// NOTE : QUaModel coalesces changes, so range can span several rows and columns
 	// getting visual rect is expensive but less than QTreeView::dataChanged
-	QRect rect = m_thiz->visualRect(topLeft);
-	// ignore data update if item out of view
-	if (rect.y() < 0 || rect.y() > m_thiz->height())
+	QRect rectTop    = m_thiz->visualRect(topLeft);
+	QRect rectBottom = topLeft == bottomRight ? rectTop : m_thiz->visualRect(bottomRight);
+	int   height     = m_thiz->height();
+	// ignore data update if whole range out of view
+	if ((rectTop.y() < 0 && rectBottom.y() < 0) || 
+		(rectTop.y() > height && rectBottom.y() > height))
 	{
+		QUaModelTracer::instance()->instant("dataChanged culled", "view");
 		return;
 	}
 	// data update is expensive
+	QUaModelTracerScope scope("dataChanged", "view");
 	m_thiz->B::dataChanged(topLeft, bottomRight, roles);
 }
 
+template<typename T, typename N, int I>
+template<typename B>
+inline void QUaView<T, N, I>::paintEvent(QPaintEvent* event)
+{
+	QUaModelTracerScope scope("paint", "view");
+	m_thiz->B::paintEvent(event);
+	if (!m_memoryOverlay)
+	{
+		return;
+	}
+	// NOTE : walks the whole model on every paint, debug only
+	QString strReport;
+	if (m_funcMemoryReport)
+	{
+		strReport = m_funcMemoryReport().toString();
+	}
+	else if (
+#ifdef Q_OS_LINUX
+		QUaViewBase<N, I>::
+#endif
+		m_model)
+	{
+		strReport = 
+#ifdef Q_OS_LINUX
+			QUaViewBase<N, I>::
+#endif
+			m_model->memoryReport().toString();
+	}
+	if (strReport.isEmpty())
+	{
+		return;
+	}
+	QPainter painter(m_thiz->viewport());
+	QRect rectText = painter.fontMetrics().boundingRect(
+		m_thiz->viewport()->rect(), Qt::AlignTop | Qt::AlignRight, strReport
+	).adjusted(-6, -4, 6, 4);
+	rectText.moveTopRight(m_thiz->viewport()->rect().topRight() - QPoint(4, -4));
+	painter.fillRect(rectText, QColor(0, 0, 0, 160));
+	painter.setPen(Qt::white);
+	painter.drawText(rectText, Qt::AlignCenter, strReport);
+}
+
 template<typename T, typename N, int I>
 template<typename B>
 inline void QUaView<T, N, I>::keyPressEvent(QKeyEvent* event)